@@ -2048,6 +2048,34 @@ namespace DataOutBase
     const VtkFlags &flags,
     std::ostream   &out);
 
+  /**
+   * Write a cloud of points with data attached to them in the VTU format,
+   * where every point forms a cell of type VTK_VERTEX. The output is the same
+   * as that of write_vtu() called with one Patch<0,spacedim> per point, but
+   * this function works directly on arrays of single precision values and
+   * so avoids building the patches, whose memory footprint is much larger
+   * than that of the data itself if there are many points (e.g., for
+   * particles, see Particles::DataOut::write_vtu()).
+   *
+   * @p point_coordinates contains three coordinates per point, padded with
+   * zeros in lower space dimensions. @p data_vectors has one row per data
+   * set and one column per point. The remaining arguments have the same
+   * meaning as for write_vtu().
+   */
+  void
+  write_vtu_point_cloud(
+    const std::vector<float>       &point_coordinates,
+    const Table<2, float>          &data_vectors,
+    const std::vector<std::string> &data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+                   &nonscalar_data_ranges,
+    const VtkFlags &flags,
+    std::ostream   &out);
+
   /**
    * This writes the header for the xml based vtu file format. This routine is
    * used internally together with DataOutInterface::write_vtu_footer() and
@@ -3108,6 +3136,14 @@ protected:
   void
   validate_dataset_names() const;
 
+  /**
+   * Return the flags to be used upon output of vtk and vtu data, for
+   * derived classes that write these formats without going through
+   * get_patches().
+   */
+  const DataOutBase::VtkFlags &
+  get_vtk_flags() const;
+
 
   /**
    * The default number of subdivisions for patches. This is filled by
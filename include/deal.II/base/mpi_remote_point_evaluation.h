@@ -183,6 +183,35 @@ namespace Utilities
              const Triangulation<dim, spacedim>                        &tria,
              const Mapping<dim, spacedim> &mapping);
 
+      /**
+       * Update the locations of the points passed to a previous call of
+       * reinit(), e.g., because the points move with a flow or a structure.
+       * The @p points vector needs to contain the new locations of the same
+       * points in the same order.
+       *
+       * Rather than setting up the communication pattern from scratch, this
+       * function sends the new locations to the processes that own the cells
+       * found during the previous setup, and each of them maps the points
+       * back to the reference coordinates of their previous cell. Points that
+       * have left their cell are searched for among the locally owned face
+       * neighbors of that cell. If this succeeds for all points on all
+       * processes, only the internal CellData is updated, and the cost of
+       * this function is that of one call to process_and_evaluate() plus the
+       * inverse mapping of the points. Otherwise, and also if the previous
+       * setup was not a one-to-one map between points and cells (see
+       * is_map_unique() and all_points_found()), this function falls back to
+       * calling reinit() with @p cache and @p points.
+       *
+       * @return Whether the previous communication pattern could be kept.
+       *   The return value is the same on all processes.
+       *
+       * @warning This is a collective call that needs to be executed by all
+       *   processors in the communicator.
+       */
+      bool
+      update_points(const GridTools::Cache<dim, spacedim> &cache,
+                    const std::vector<Point<spacedim>>    &points);
+
       /**
        * Helper class to store and to access data of points positioned in
        * processed cells.
@@ -111,6 +111,8 @@ namespace Utilities
           particle_handler_send_recv_particles_cache_setup,
           /// ParticleHandler<dim, spacedim>::send_recv_particles
           particle_handler_send_recv_particles_send,
+          /// ParticleHandler<dim, spacedim>::update_ghost_particles
+          particle_handler_update_ghost_particles,
 
           /// ScaLAPACKMatrix<NumberType>::copy_to
           scalapack_copy_to,
@@ -20,6 +20,8 @@
 
 #  include <deal.II/base/exceptions.h>
 
+#  include <atomic>
+#  include <cstdint>
 #  include <list>
 #  include <map>
 #  include <memory>
@@ -70,6 +72,19 @@ namespace Threads
     {
       using type = T;
     };
+
+    /*
+     * Return a number that has not been returned before by this function
+     * during the lifetime of the program. ThreadLocalStorage objects use
+     * these numbers to identify the state of their data in the per-thread
+     * lookup caches.
+     */
+    inline std::uint64_t
+    new_thread_local_storage_id()
+    {
+      static std::atomic<std::uint64_t> counter{0};
+      return ++counter;
+    }
   } // namespace internal
 #  endif
 
@@ -99,6 +114,19 @@ namespace Threads
    * function. It provides a reference to a unique object when accessed from
    * different threads. Objects of type T are created lazily, i.e. they are
    * only created whenever a thread actually calls get().
+   *
+   * Since the T object of a thread is created by the thread itself, its
+   * memory is first touched by that thread. On machines with several NUMA
+   * domains, the operating system then typically places it in memory close
+   * to the core that will use it.
+   *
+   * Each thread remembers the location of the last few objects it has
+   * obtained through get() in a small cache. Repeated calls to get() from
+   * the same thread, as done for example by WorkStream::run() for every
+   * item it processes, are then answered without taking a lock and without
+   * searching the internal data structures of this class. Only the first
+   * call on a thread, or a call after the object has been cleared, copied
+   * into or moved from, falls back to a lookup protected by a mutex.
    */
   template <typename T>
   class ThreadLocalStorage
@@ -274,6 +302,36 @@ namespace Threads
      * An exemplar for creating a new (thread specific) copy.
      */
     std::shared_ptr<const T> exemplar;
+
+    /**
+     * A number that uniquely identifies the current contents of the data
+     * object. It is changed whenever previously stored objects may have
+     * been removed from data, which invalidates all entries of the
+     * per-thread caches that refer to this object.
+     */
+    std::atomic<std::uint64_t> id{internal::new_thread_local_storage_id()};
+
+    /**
+     * An entry of the per-thread cache of objects returned by get().
+     */
+    struct CacheEntry
+    {
+      std::uint64_t id     = 0;
+      T            *object = nullptr;
+    };
+
+    /**
+     * The number of entries in the per-thread cache.
+     */
+    static constexpr unsigned int cache_size = 8;
+
+    /**
+     * Return the cache entry of the current thread that may hold the
+     * object of this thread for the ThreadLocalStorage object with the
+     * given @p id.
+     */
+    static CacheEntry &
+    cache_entry(const std::uint64_t id);
   };
 } // namespace Threads
 /**
@@ -289,6 +347,7 @@ namespace Threads
   template <typename T>
   ThreadLocalStorage<T>::ThreadLocalStorage(const ThreadLocalStorage<T> &t)
     : exemplar(t.exemplar)
+    , id(internal::new_thread_local_storage_id())
   {
     // Raise a reader lock while we are populating our own data in order to
     // avoid copying over an invalid state.
@@ -301,6 +360,7 @@ namespace Threads
   template <typename T>
   ThreadLocalStorage<T>::ThreadLocalStorage(ThreadLocalStorage<T> &&t) noexcept
     : exemplar(std::move(t.exemplar))
+    , id(internal::new_thread_local_storage_id())
   {
     // We are nice and raise the writer lock before copying over internal
     // data structures from the argument.
@@ -322,6 +382,7 @@ namespace Threads
     // conceptually the right thing, so ask for that lock:
     std::unique_lock<decltype(insertion_mutex)> lock(t.insertion_mutex);
     data = std::move(t.data);
+    t.id = internal::new_thread_local_storage_id();
   }
 
 
@@ -351,6 +412,7 @@ namespace Threads
 
     data     = t.data;
     exemplar = t.exemplar;
+    id       = internal::new_thread_local_storage_id();
 
     return *this;
   }
@@ -372,6 +434,8 @@ namespace Threads
 
     data     = std::move(t.data);
     exemplar = std::move(t.exemplar);
+    id       = internal::new_thread_local_storage_id();
+    t.id     = internal::new_thread_local_storage_id();
 
     return *this;
   }
@@ -416,10 +480,32 @@ namespace Threads
 #    endif
 
 
+  template <typename T>
+  inline typename ThreadLocalStorage<T>::CacheEntry &
+  ThreadLocalStorage<T>::cache_entry(const std::uint64_t id)
+  {
+    static thread_local CacheEntry cache[cache_size];
+    return cache[id % cache_size];
+  }
+
+
+
   template <typename T>
   inline T &
   ThreadLocalStorage<T>::get(bool &exists)
   {
+    // First look into the cache of the current thread. An entry with our
+    // current id can only have been created by a previous call to this
+    // function on this thread, and the object it points to has not been
+    // removed since, because every such removal changes the id.
+    const std::uint64_t my_cache_id = id.load(std::memory_order_relaxed);
+    CacheEntry         &entry       = cache_entry(my_cache_id);
+    if (entry.id == my_cache_id)
+      {
+        exists = true;
+        return *entry.object;
+      }
+
     const std::thread::id my_id = std::this_thread::get_id();
 
     // Note that std::map<..>::emplace guarantees that no iterators or
@@ -437,7 +523,9 @@ namespace Threads
       const auto it = data.find(my_id);
       if (it != data.end())
         {
-          exists = true;
+          exists       = true;
+          entry.id     = my_cache_id;
+          entry.object = &it->second;
           return it->second;
         }
       else
@@ -451,7 +539,10 @@ namespace Threads
       // lock ensures that no other thread does a lookup at the same time.
       std::unique_lock<decltype(insertion_mutex)> lock(insertion_mutex);
 
-      return internal::construct_element(data, my_id, exemplar);
+      T &object    = internal::construct_element(data, my_id, exemplar);
+      entry.id     = my_cache_id;
+      entry.object = &object;
+      return object;
     }
   }
 
@@ -513,6 +604,7 @@ namespace Threads
   {
     std::unique_lock<decltype(insertion_mutex)> lock(insertion_mutex);
     data.clear();
+    id = internal::new_thread_local_storage_id();
   }
 } // namespace Threads
 
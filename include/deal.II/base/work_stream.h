@@ -34,9 +34,11 @@
 #    endif
 #  endif
 
+#  include <algorithm>
 #  include <functional>
 #  include <iterator>
 #  include <memory>
+#  include <mutex>
 #  include <utility>
 #  include <vector>
 
@@ -997,6 +999,148 @@ namespace WorkStream
       }
 
     }    // namespace tbb_colored
+
+
+
+    /**
+     * A namespace for the implementation of the variant of WorkStream::run()
+     * in which workers run in any order and each copier only locks the
+     * entries of the global object its item writes into, rather than having
+     * conflicts resolved ahead of time by a graph coloring.
+     */
+    namespace tbb_conflict_locking
+    {
+      /**
+       * A table of mutexes, each of which protects a set of ranges of global
+       * indices. A copier has to acquire all mutexes that guard its
+       * conflict indices before it may write into the global object. The
+       * mutexes are always acquired in ascending order, which rules out
+       * deadlocks between copiers that run concurrently.
+       *
+       * Indices are grouped into ranges of @p range_size consecutive
+       * entries before being mapped to a mutex, since the degrees of freedom
+       * of one cell are typically numbered close to each other. This keeps
+       * the number of locks a copier needs small at the cost of some
+       * additional, spurious serialization between copiers whose indices
+       * happen to map to the same mutex.
+       */
+      class ConflictLockTable
+      {
+      public:
+        /**
+         * Constructor.
+         */
+        ConflictLockTable(const unsigned int n_mutexes  = 1024,
+                          const unsigned int range_size = 8)
+          : mutexes(n_mutexes)
+          , range_size(range_size)
+        {
+          Assert(n_mutexes > 0, ExcMessage("Need at least one mutex."));
+          Assert(range_size > 0,
+                 ExcMessage("The range size must be positive."));
+        }
+
+        /**
+         * Lock all mutexes that guard one of the given @p indices, call
+         * @p function, and release the mutexes again. The mutexes are also
+         * released if @p function throws an exception.
+         */
+        template <typename Function>
+        void
+        run_locked(const std::vector<types::global_dof_index> &indices,
+                   const Function                             &function)
+        {
+          std::vector<unsigned int> mutex_indices;
+          mutex_indices.reserve(indices.size());
+          for (const types::global_dof_index i : indices)
+            mutex_indices.push_back((i / range_size) % mutexes.size());
+          std::sort(mutex_indices.begin(), mutex_indices.end());
+          mutex_indices.erase(std::unique(mutex_indices.begin(),
+                                          mutex_indices.end()),
+                              mutex_indices.end());
+
+          std::vector<std::unique_lock<std::mutex>> locks;
+          locks.reserve(mutex_indices.size());
+          for (const unsigned int m : mutex_indices)
+            locks.emplace_back(mutexes[m]);
+
+          function();
+        }
+
+      private:
+        /**
+         * The mutexes.
+         */
+        std::vector<std::mutex> mutexes;
+
+        /**
+         * The number of consecutive indices that are guarded by the same
+         * mutex.
+         */
+        const unsigned int range_size;
+      };
+
+
+
+      /**
+       * The run function using TBB. All items are handed to a single
+       * parallel_for(), whose work-stealing scheduler balances the load
+       * also when the cost per item varies strongly. The copier of an item
+       * runs on the same thread directly after its worker, as soon as the
+       * item's conflict indices can be locked.
+       */
+      template <typename Worker,
+                typename Copier,
+                typename Iterator,
+                typename ScratchData,
+                typename CopyData>
+      void
+      run(const std::vector<Iterator> &iterators,
+          const std::function<std::vector<types::global_dof_index>(
+            const Iterator &)>        &get_conflict_indices,
+          Worker                       worker,
+          Copier                       copier,
+          const ScratchData           &sample_scratch_data,
+          const CopyData              &sample_copy_data,
+          const unsigned int           chunk_size)
+      {
+        const std::function<void(const Iterator &, ScratchData &, CopyData &)>
+                                                    worker_function = worker;
+        const std::function<void(const CopyData &)> copier_function = copier;
+
+        ConflictLockTable lock_table;
+
+        // Wrap worker and copier into a single function that the colored
+        // implementation can then run with an empty copier. The scratch and
+        // copy data objects are managed in the same way as there.
+        const auto worker_and_locked_copier =
+          [&](const Iterator &it, ScratchData &scratch, CopyData &copy) {
+            if (worker_function)
+              worker_function(it, scratch, copy);
+            if (copier_function)
+              lock_table.run_locked(get_conflict_indices(it),
+                                    [&]() { copier_function(copy); });
+          };
+
+        using WorkerAndCopier = internal::tbb_colored::
+          WorkerAndCopier<Iterator, ScratchData, CopyData>;
+        WorkerAndCopier worker_and_copier(
+          worker_and_locked_copier,
+          std::function<void(const CopyData &)>(),
+          sample_scratch_data,
+          sample_copy_data);
+
+        parallel::internal::parallel_for(
+          iterators.begin(),
+          iterators.end(),
+          [&worker_and_copier](
+            const tbb::blocked_range<
+              typename std::vector<Iterator>::const_iterator> &range) {
+            worker_and_copier(range);
+          },
+          chunk_size);
+      }
+    } // namespace tbb_conflict_locking
 #  endif // DEAL_II_WITH_TBB
 
 
@@ -1312,6 +1456,87 @@ namespace WorkStream
 
 
 
+  /**
+   * A variant of the main functions of the WorkStream concept that neither
+   * serializes the copier (as the run() function taking a range of iterators
+   * does) nor requires a graph coloring of the items (as the run() function
+   * taking a vector of vectors of iterators does). Instead, the function
+   * object @p get_conflict_indices returns for each item the indices of the
+   * global object the copier writes into for this item, typically the
+   * degrees of freedom of a cell, in the same way as for
+   * GraphColoring::make_graph_coloring(). Workers run in any order, and the
+   * copier for an item is executed right after its worker once none of the
+   * copiers running concurrently writes into one of the item's conflict
+   * indices.
+   *
+   * Since all items are handed to the task scheduler at once, threads that
+   * have finished their items steal work from the others. This makes the
+   * function attractive if the cost of the worker varies strongly between
+   * items, e.g., for hp-adaptive discretizations or cut cells, where the
+   * synchronization after each color of the colored variant leaves threads
+   * idle. The conflict indices are only used for locking and are not
+   * stored, so there is no setup cost beyond collecting the iterators.
+   *
+   * In contrast to the other variants, the copier is called in an
+   * unspecified order, and the function is therefore only appropriate if
+   * the result of the copy operations does not depend on their order (up
+   * to round-off, if floating point numbers are added up).
+   *
+   * The @p chunk_size argument denotes the minimal number of items that
+   * are handed to a thread at once. The requirements on the worker, the
+   * copier and the <tt>ScratchData</tt> and <tt>CopyData</tt> types are
+   * the same as for the other variants. Without multithreading support, or
+   * if only one thread is used, all items are processed sequentially in
+   * the order given.
+   */
+  template <typename ConflictIndicesFunction,
+            typename Worker,
+            typename Copier,
+            typename Iterator,
+            typename ScratchData,
+            typename CopyData>
+  void
+  run_with_conflicts(const Iterator                             &begin,
+                     const std_cxx20::type_identity_t<Iterator> &end,
+                     const ConflictIndicesFunction &get_conflict_indices,
+                     Worker                         worker,
+                     Copier                         copier,
+                     const ScratchData             &sample_scratch_data,
+                     const CopyData                &sample_copy_data,
+                     const unsigned int             chunk_size = 8)
+  {
+    Assert(chunk_size > 0, ExcMessage("The chunk_size must be at least one."));
+    (void)chunk_size; // removes -Wunused-parameter warning in optimized mode
+    (void)get_conflict_indices;
+
+    if (MultithreadInfo::n_threads() > 1)
+      {
+#  ifdef DEAL_II_WITH_TBB
+        std::vector<Iterator> iterators;
+        for (Iterator it = begin; it != end; ++it)
+          iterators.push_back(it);
+
+        internal::tbb_conflict_locking::run(
+          iterators,
+          std::function<std::vector<types::global_dof_index>(
+            const Iterator &)>(get_conflict_indices),
+          worker,
+          copier,
+          sample_scratch_data,
+          sample_copy_data,
+          chunk_size);
+
+        // exit this function to not run the sequential version below:
+        return;
+#  endif
+      }
+
+    internal::sequential::run(
+      begin, end, worker, copier, sample_scratch_data, sample_copy_data);
+  }
+
+
+
   /**
    * This is a variant of one of the two main functions of the WorkStream
    * concept, doing work as described in the introduction to this namespace.
@@ -23,6 +23,9 @@
 
 #include <deal.II/dofs/dof_handler.h>
 
+#include <deal.II/grid/cell_id.h>
+
+#include <map>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -638,6 +641,48 @@ namespace DoFRenumbering
                 const std::vector<types::global_dof_index> &starting_indices =
                   std::vector<types::global_dof_index>());
 
+  /**
+   * Renumber the degrees of freedom according to the Cuthill-McKee method
+   * (or its reverse), like the Cuthill_McKee() function above, but without
+   * building a sparsity pattern. Instead, the algorithm works on the
+   * cell-to-DoF connectivity of the DoFHandler: two degrees of freedom are
+   * considered neighbors if they share a cell, and the coordination number
+   * used to sort each front is approximated by the sum of the number of
+   * degrees of freedom of the cells a degree of freedom lives on. The
+   * connectivity only needs as much memory as the cell-wise DoF indices,
+   * rather than one entry per matrix coupling as a DynamicSparsityPattern,
+   * and is set up with several threads; the neighbors of each front are
+   * also collected in parallel.
+   *
+   * As the coupling through hanging node constraints is not taken into
+   * account, the result corresponds to the Cuthill_McKee() function with
+   * <code>use_constraints=false</code>, up to the different sorting within
+   * each front caused by the approximated coordination numbers. The
+   * resulting numbering is deterministic, i.e., independent of the number of
+   * threads.
+   *
+   * For parallel triangulations, each process renumbers its locally owned
+   * degrees of freedom within the set of indices it owned before, as in the
+   * Cuthill_McKee() function above.
+   */
+  template <int dim, int spacedim>
+  void
+  cell_based_Cuthill_McKee(DoFHandler<dim, spacedim> &dof_handler,
+                           const bool reversed_numbering = false);
+
+  /**
+   * Compute the renumbering vector needed by the cell_based_Cuthill_McKee()
+   * function. This function does not perform the renumbering on the
+   * DoFHandler DoFs but only returns the renumbering vector of length
+   * <code>dof_handler.n_locally_owned_dofs()</code>.
+   */
+  template <int dim, int spacedim>
+  void
+  compute_cell_based_Cuthill_McKee(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    const DoFHandler<dim, spacedim>      &dof_handler,
+    const bool                            reversed_numbering = false);
+
   /**
    * @name Component-wise numberings
    * @{
@@ -841,6 +886,44 @@ namespace DoFRenumbering
   void
   hierarchical(DoFHandler<dim, spacedim> &dof_handler);
 
+  /**
+   * Renumber the degrees of freedom cell by cell by traversing the locally
+   * owned active cells along a Hilbert space filling curve through the cell
+   * centers, see Utilities::inverse_Hilbert_space_filling_curve(). The
+   * degrees of freedom are then numbered as in cell_wise(), i.e., the degrees
+   * of freedom of a cell are numbered consecutively when the cell is visited
+   * first, which groups them into blocks that are accessed together in
+   * cell-based loops.
+   *
+   * In contrast to hierarchical(), this function does not rely on the
+   * refinement hierarchy of the mesh, and therefore also produces a
+   * localized ordering for unstructured coarse meshes, e.g., tetrahedral
+   * meshes read from a file, where the cells of the coarse mesh are stored
+   * in an arbitrary order. Consecutive cells along the Hilbert curve are
+   * close in space, so the resulting numbering typically has good data
+   * locality for sparse matrix-vector products. The cost of the algorithm is
+   * dominated by sorting the cells, i.e., it runs in ${\cal O}(N \log N)$
+   * for $N$ cells, without building the sparsity pattern needed by
+   * Cuthill_McKee().
+   *
+   * For parallel triangulations, each process orders its locally owned cells
+   * and renumbers the degrees of freedom within its locally owned range.
+   */
+  template <int dim, int spacedim>
+  void
+  hilbert_curve(DoFHandler<dim, spacedim> &dof_handler);
+
+  /**
+   * Compute the renumbering vector needed by the hilbert_curve() function.
+   * Does not perform the renumbering on the DoFHandler dofs but returns the
+   * renumbering vector of length <code>dof_handler.n_locally_owned_dofs()
+   * </code>.
+   */
+  template <int dim, int spacedim>
+  void
+  compute_hilbert_curve(std::vector<types::global_dof_index> &new_dof_indices,
+                        const DoFHandler<dim, spacedim>      &dof_handler);
+
   /**
    * Renumber degrees of freedom by cell. The function takes a vector of cell
    * iterators (which needs to list <i>all</i> locally owned active cells of the
@@ -1227,6 +1310,85 @@ namespace DoFRenumbering
    * @}
    */
 
+  /**
+   * @name Numberings that preserve a previous numbering
+   * @{
+   */
+
+  /**
+   * Return the active FE index and the DoF indices of all active cells of
+   * @p dof_handler, keyed by the CellId of each cell. The result is meant to
+   * be stored before the triangulation is adaptively refined and coarsened,
+   * so that preserve_previous_numbering() can later identify the cells that
+   * were not touched by the mesh change.
+   *
+   * This function only works on sequential triangulations.
+   */
+  template <int dim, int spacedim>
+  std::map<CellId,
+           std::pair<types::fe_index, std::vector<types::global_dof_index>>>
+  extract_cell_dof_indices(const DoFHandler<dim, spacedim> &dof_handler);
+
+  /**
+   * Renumber the degrees of freedom on a DoFHandler that has just been set up
+   * with DoFHandler::distribute_dofs() after a local mesh change, such that
+   * the numbering is as close as possible to the one before the mesh change.
+   * The previous numbering is given by @p previous_cell_dof_indices, as
+   * returned by extract_cell_dof_indices() before the mesh change.
+   *
+   * All active cells that still exist with the same CellId and the same
+   * active FE index are considered unchanged. The degrees of
+   * freedom on these cells keep their relative order from the previous
+   * numbering. All other degrees of freedom, i.e., the ones on cells that
+   * have been refined or coarsened, are placed right after the degrees of
+   * freedom of the parent cell (or, if there is no parent in the previous
+   * numbering, after the last previously numbered degree of freedom
+   * encountered in the loop over cells). If only a small part of the mesh
+   * changes, most of the vector entries therefore stay at (almost) the same
+   * position. The work is linear in the number of degrees of freedom, plus
+   * one lookup in @p previous_cell_dof_indices per active cell.
+   *
+   * The function returns a map from the previous to the new DoF indices. Its
+   * size is one plus the largest index in @p previous_cell_dof_indices. The
+   * entries of degrees of freedom that no longer exist are set to
+   * numbers::invalid_dof_index. This map can be used to transfer vectors
+   * between the two numberings on the unchanged part of the mesh without an
+   * interpolation, e.g., in combination with SolutionTransfer only on the
+   * changed part.
+   *
+   * This function only works on sequential triangulations.
+   */
+  template <int dim, int spacedim>
+  std::vector<types::global_dof_index>
+  preserve_previous_numbering(
+    DoFHandler<dim, spacedim> &dof_handler,
+    const std::map<
+      CellId,
+      std::pair<types::fe_index, std::vector<types::global_dof_index>>>
+      &previous_cell_dof_indices);
+
+  /**
+   * Compute the renumbering vector needed by the
+   * preserve_previous_numbering() function. Does not perform the renumbering
+   * on the DoFHandler dofs but returns the renumbering vector, as well as the
+   * map from the previous to the new indices in @p previous_to_new_indices.
+   * The latter is expressed in terms of the renumbered indices.
+   */
+  template <int dim, int spacedim>
+  void
+  compute_preserve_previous_numbering(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    std::vector<types::global_dof_index> &previous_to_new_indices,
+    const DoFHandler<dim, spacedim>      &dof_handler,
+    const std::map<
+      CellId,
+      std::pair<types::fe_index, std::vector<types::global_dof_index>>>
+      &previous_cell_dof_indices);
+
+  /**
+   * @}
+   */
+
   /**
    * @name Numberings based on properties of the finite element space
    * @{
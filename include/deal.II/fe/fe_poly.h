@@ -20,10 +20,13 @@
 
 #include <deal.II/base/quadrature.h>
 #include <deal.II/base/scalar_polynomials_base.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/fe/fe.h>
 
 #include <memory>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -269,106 +272,32 @@ protected:
   {
     (void)mapping;
 
-    // generate a new data object and
-    // initialize some fields
+    // the values and derivatives of the shape functions on the reference
+    // cell only depend on the quadrature formula and on the update flags,
+    // so get them from the cache shared by all InternalData objects of
+    // this element
     std::unique_ptr<typename FiniteElement<dim, spacedim>::InternalDataBase>
-          data_ptr   = std::make_unique<InternalData>();
+      data_ptr = std::make_unique<InternalData>(
+        get_reference_data(update_flags, quadrature));
+
     auto &data       = dynamic_cast<InternalData &>(*data_ptr);
     data.update_each = requires_update_flags(update_flags);
 
     const unsigned int n_q_points = quadrature.size();
 
-    // initialize some scratch arrays. we need them for the underlying
-    // polynomial to put the values and derivatives of shape functions
-    // to put there, depending on what the user requested
-    std::vector<double> values(
-      update_flags & update_values ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<1, dim>> grads(
-      update_flags & update_gradients ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<2, dim>> grad_grads(
-      update_flags & update_hessians ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<3, dim>> third_derivatives(
-      update_flags & update_3rd_derivatives ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<4, dim>>
-      fourth_derivatives; // won't be needed, so leave empty
-
-    // now also initialize fields the fields of this class's own
-    // temporary storage, depending on what we need for the given
-    // update flags.
-    //
-    // there is one exception from the rule: if we are dealing with
-    // cells (i.e., if this function is not called via
-    // get_(sub)face_data()), then we can already store things in the
-    // final location where FEValues::reinit() later wants to see
-    // things. we then don't need the intermediate space. we determine
-    // whether we are on a cell by asking whether the number of
-    // elements in the output array equals the number of quadrature
-    // points (yes, it's a cell) or not (because in that case the
-    // number of quadrature points we use here equals the number of
-    // quadrature points summed over *all* faces or subfaces, whereas
-    // the number of output slots equals the number of quadrature
-    // points on only *one* face)
+    // the values of shape functions at quadrature points don't change.
+    // consequently, write these values right into the output array if we
+    // can, i.e., if the output array has the correct size. this is the case
+    // on cells. on faces, we already precompute data on *all* faces and
+    // subfaces, but we later on copy only a portion of it into the output
+    // object
     if ((update_flags & update_values) &&
-        !((output_data.shape_values.n_rows() > 0) &&
-          (output_data.shape_values.n_cols() == n_q_points)))
-      data.shape_values.reinit(this->n_dofs_per_cell(), n_q_points);
-
-    if (update_flags & update_gradients)
-      data.shape_gradients.reinit(this->n_dofs_per_cell(), n_q_points);
-
-    if (update_flags & update_hessians)
-      data.shape_hessians.reinit(this->n_dofs_per_cell(), n_q_points);
-
-    if (update_flags & update_3rd_derivatives)
-      data.shape_3rd_derivatives.reinit(this->n_dofs_per_cell(), n_q_points);
-
-    // next already fill those fields of which we have information by
-    // now. note that the shape gradients are only those on the unit
-    // cell, and need to be transformed when visiting an actual cell
-    if (update_flags & (update_values | update_gradients | update_hessians |
-                        update_3rd_derivatives))
-      for (unsigned int i = 0; i < n_q_points; ++i)
-        {
-          poly_space->evaluate(quadrature.point(i),
-                               values,
-                               grads,
-                               grad_grads,
-                               third_derivatives,
-                               fourth_derivatives);
-
-          // the values of shape functions at quadrature points don't change.
-          // consequently, write these values right into the output array if
-          // we can, i.e., if the output array has the correct size. this is
-          // the case on cells. on faces, we already precompute data on *all*
-          // faces and subfaces, but we later on copy only a portion of it
-          // into the output object; in that case, copy the data from all
-          // faces into the scratch object
-          if (update_flags & update_values)
-            if (output_data.shape_values.n_rows() > 0)
-              {
-                if (output_data.shape_values.n_cols() == n_q_points)
-                  for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-                    output_data.shape_values[k][i] = values[k];
-                else
-                  for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-                    data.shape_values[k][i] = values[k];
-              }
-
-          // for everything else, derivatives need to be transformed,
-          // so we write them into our scratch space and only later
-          // copy stuff into where FEValues wants it
-          if (update_flags & update_gradients)
-            for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-              data.shape_gradients[k][i] = grads[k];
-
-          if (update_flags & update_hessians)
-            for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-              data.shape_hessians[k][i] = grad_grads[k];
-
-          if (update_flags & update_3rd_derivatives)
-            for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-              data.shape_3rd_derivatives[k][i] = third_derivatives[k];
-        }
+        (output_data.shape_values.n_rows() > 0) &&
+        (output_data.shape_values.n_cols() == n_q_points))
+      for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+        for (unsigned int i = 0; i < n_q_points; ++i)
+          output_data.shape_values[k][i] = data.shape_values[k][i];
+
     return data_ptr;
   }
 
@@ -417,6 +346,66 @@ protected:
                                                                        spacedim>
       &output_data) const override;
 
+  /**
+   * Values and derivatives of the shape functions on the reference cell,
+   * evaluated at the points of a quadrature formula. Objects of this type
+   * are immutable once created and are shared among all InternalData objects
+   * that were created for the same quadrature points, see
+   * get_reference_data().
+   */
+  struct ReferenceData
+  {
+    /**
+     * The quadrature points at which the shape functions were evaluated.
+     */
+    std::vector<Point<dim>> points;
+
+    /**
+     * The subset of update_values, update_gradients, update_hessians, and
+     * update_3rd_derivatives for which the tables below have been filled.
+     */
+    UpdateFlags update_flags;
+
+    /**
+     * Array with shape function values in quadrature points. There is one row
+     * for each shape function, containing values for each quadrature point.
+     */
+    Table<2, double> shape_values;
+
+    /**
+     * Array with shape function gradients on the unit cell in quadrature
+     * points, with the same layout as #shape_values.
+     */
+    Table<2, Tensor<1, dim>> shape_gradients;
+
+    /**
+     * Array with shape function hessians on the unit cell in quadrature
+     * points, with the same layout as #shape_values.
+     */
+    Table<2, Tensor<2, dim>> shape_hessians;
+
+    /**
+     * Array with shape function third derivatives on the unit cell in
+     * quadrature points, with the same layout as #shape_values.
+     */
+    Table<2, Tensor<3, dim>> shape_3rd_derivatives;
+  };
+
+  /**
+   * Return the values and derivatives of the shape functions on the
+   * reference cell at the points of @p quadrature, as requested by
+   * @p update_flags. If another InternalData object created for the same
+   * quadrature points is still alive, the tables it uses are returned
+   * instead of computing them again. This way, the many FEValues objects that
+   * are typically created for the same element and quadrature formula, e.g.,
+   * one per thread in WorkStream::run(), only store this data once.
+   *
+   * This function is thread-safe.
+   */
+  std::shared_ptr<const ReferenceData>
+  get_reference_data(const UpdateFlags      update_flags,
+                     const Quadrature<dim> &quadrature) const;
+
   /**
    * Fields of cell-independent data.
    *
@@ -426,6 +415,33 @@ protected:
   class InternalData : public FiniteElement<dim, spacedim>::InternalDataBase
   {
   public:
+    /**
+     * Default constructor. The object owns its tables, which are empty.
+     * Derived elements that compute the tables themselves can fill a
+     * ReferenceData object and pass it to the other constructor instead.
+     */
+    InternalData()
+      : InternalData(std::make_shared<const ReferenceData>())
+    {}
+
+    /**
+     * Constructor. The tables of this object are references into
+     * @p reference_data, which is kept alive as long as this object exists.
+     */
+    InternalData(const std::shared_ptr<const ReferenceData> &reference_data)
+      : reference_data(reference_data)
+      , shape_values(reference_data->shape_values)
+      , shape_gradients(reference_data->shape_gradients)
+      , shape_hessians(reference_data->shape_hessians)
+      , shape_3rd_derivatives(reference_data->shape_3rd_derivatives)
+    {}
+
+    /**
+     * The shared values and derivatives of the shape functions on the
+     * reference cell.
+     */
+    const std::shared_ptr<const ReferenceData> reference_data;
+
     /**
      * Array with shape function values in quadrature points. There is one row
      * for each shape function, containing values for each quadrature point.
@@ -435,7 +451,7 @@ protected:
      * under transformation to the real cell, we only need to copy them over
      * when visiting a concrete cell.
      */
-    Table<2, double> shape_values;
+    const Table<2, double> &shape_values;
 
     /**
      * Array with shape function gradients in quadrature points. There is one
@@ -446,7 +462,7 @@ protected:
      * then only have to apply the transformation (which is a matrix-vector
      * multiplication) when visiting an actual cell.
      */
-    Table<2, Tensor<1, dim>> shape_gradients;
+    const Table<2, Tensor<1, dim>> &shape_gradients;
 
     /**
      * Array with shape function hessians in quadrature points. There is one
@@ -457,7 +473,7 @@ protected:
      * then only have to apply the transformation when visiting an actual
      * cell.
      */
-    Table<2, Tensor<2, dim>> shape_hessians;
+    const Table<2, Tensor<2, dim>> &shape_hessians;
 
     /**
      * Array with shape function third derivatives in quadrature points. There
@@ -468,7 +484,7 @@ protected:
      * cell. We then only have to apply the transformation when visiting an
      * actual cell.
      */
-    Table<2, Tensor<3, dim>> shape_3rd_derivatives;
+    const Table<2, Tensor<3, dim>> &shape_3rd_derivatives;
   };
 
   /**
@@ -530,6 +546,19 @@ protected:
    * The polynomial space.
    */
   const std::unique_ptr<ScalarPolynomialsBase<dim>> poly_space;
+
+private:
+  /**
+   * A mutex guarding access to #reference_data_cache.
+   */
+  mutable Threads::Mutex reference_data_mutex;
+
+  /**
+   * The reference data handed out by get_reference_data(). Only weak
+   * pointers are stored, so that the data is released once the last
+   * InternalData object using it has been destroyed.
+   */
+  mutable std::vector<std::weak_ptr<const ReferenceData>> reference_data_cache;
 };
 
 /** @} */
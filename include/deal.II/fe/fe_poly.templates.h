@@ -29,6 +29,8 @@
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/fe/mapping_cartesian.h>
 
+#include <algorithm>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -212,6 +214,102 @@ FE_Poly<dim, spacedim>::requires_update_flags(const UpdateFlags flags) const
 
 
 
+template <int dim, int spacedim>
+std::shared_ptr<const typename FE_Poly<dim, spacedim>::ReferenceData>
+FE_Poly<dim, spacedim>::get_reference_data(
+  const UpdateFlags      update_flags,
+  const Quadrature<dim> &quadrature) const
+{
+  const UpdateFlags flags = update_flags & (update_values | update_gradients |
+                                            update_hessians |
+                                            update_3rd_derivatives);
+
+  std::lock_guard<std::mutex> lock(reference_data_mutex);
+
+  // drop the entries that are no longer in use, and look for one computed
+  // at the same points that contains (at least) the requested fields
+  reference_data_cache.erase(
+    std::remove_if(reference_data_cache.begin(),
+                   reference_data_cache.end(),
+                   [](const std::weak_ptr<const ReferenceData> &entry) {
+                     return entry.expired();
+                   }),
+    reference_data_cache.end());
+  for (const auto &entry : reference_data_cache)
+    if (const std::shared_ptr<const ReferenceData> data = entry.lock())
+      if (((data->update_flags & flags) == flags) &&
+          (data->points == quadrature.get_points()))
+        return data;
+
+  // nothing found, so evaluate the polynomial space at the quadrature points
+  auto data          = std::make_shared<ReferenceData>();
+  data->points       = quadrature.get_points();
+  data->update_flags = flags;
+
+  const unsigned int n_q_points = quadrature.size();
+
+  // initialize some scratch arrays. we need them for the underlying
+  // polynomial to put the values and derivatives of shape functions
+  // to put there, depending on what the user requested
+  std::vector<double> values(
+    flags & update_values ? this->n_dofs_per_cell() : 0);
+  std::vector<Tensor<1, dim>> grads(
+    flags & update_gradients ? this->n_dofs_per_cell() : 0);
+  std::vector<Tensor<2, dim>> grad_grads(
+    flags & update_hessians ? this->n_dofs_per_cell() : 0);
+  std::vector<Tensor<3, dim>> third_derivatives(
+    flags & update_3rd_derivatives ? this->n_dofs_per_cell() : 0);
+  std::vector<Tensor<4, dim>>
+    fourth_derivatives; // won't be needed, so leave empty
+
+  if (flags & update_values)
+    data->shape_values.reinit(this->n_dofs_per_cell(), n_q_points);
+
+  if (flags & update_gradients)
+    data->shape_gradients.reinit(this->n_dofs_per_cell(), n_q_points);
+
+  if (flags & update_hessians)
+    data->shape_hessians.reinit(this->n_dofs_per_cell(), n_q_points);
+
+  if (flags & update_3rd_derivatives)
+    data->shape_3rd_derivatives.reinit(this->n_dofs_per_cell(), n_q_points);
+
+  // note that the shape derivatives are only those on the unit cell, and
+  // need to be transformed when visiting an actual cell
+  if (flags != update_default)
+    for (unsigned int i = 0; i < n_q_points; ++i)
+      {
+        poly_space->evaluate(quadrature.point(i),
+                             values,
+                             grads,
+                             grad_grads,
+                             third_derivatives,
+                             fourth_derivatives);
+
+        if (flags & update_values)
+          for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+            data->shape_values[k][i] = values[k];
+
+        if (flags & update_gradients)
+          for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+            data->shape_gradients[k][i] = grads[k];
+
+        if (flags & update_hessians)
+          for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+            data->shape_hessians[k][i] = grad_grads[k];
+
+        if (flags & update_3rd_derivatives)
+          for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+            data->shape_3rd_derivatives[k][i] = third_derivatives[k];
+      }
+
+  reference_data_cache.emplace_back(data);
+
+  return data;
+}
+
+
+
 //---------------------------------------------------------------------------
 // Fill data of FEValues
 //---------------------------------------------------------------------------
@@ -0,0 +1,607 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_fe_values_batch_h
+#define dealii_fe_values_batch_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe.h>
+#include <deal.II/fe/fe_update_flags.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/manifold.h>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A class that computes the same information as FEValues, but for a batch
+ * of up to VectorizedArrayType::size() cells at once. All quantities that
+ * depend on the cell (Jacobians, their inverses and determinants, the
+ * location of quadrature points, and the gradients of shape functions in
+ * real space) are computed and stored with VectorizedArrayType, i.e., each
+ * SIMD lane holds the data of one cell of the batch. This allows matrix-based
+ * assembly loops to use the same SIMD throughput as FEEvaluation without
+ * rewriting them in matrix-free style: one assembles the local matrices of
+ * all cells in the batch simultaneously and then extracts the contributions
+ * of the individual cells (lanes) when distributing them into the global
+ * matrix.
+ *
+ * A typical loop looks like this:
+ * @code
+ *   FEValuesBatch<dim> fe_values(fe, quadrature,
+ *                                update_gradients | update_JxW_values);
+ *   constexpr unsigned int n_lanes = VectorizedArray<double>::size();
+ *
+ *   std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+ *   for (const auto &cell : dof_handler.active_cell_iterators())
+ *     cells.push_back(cell);
+ *
+ *   for (unsigned int batch = 0; batch < cells.size(); batch += n_lanes)
+ *     {
+ *       const unsigned int n_filled = std::min<unsigned int>(
+ *         n_lanes, cells.size() - batch);
+ *       fe_values.reinit(make_array_view(cells.begin() + batch,
+ *                                        cells.begin() + batch + n_filled));
+ *
+ *       // compute cell_matrix(i,j) as VectorizedArray<double> ...
+ *       for (unsigned int q = 0; q < fe_values.n_quadrature_points; ++q)
+ *         for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+ *           for (unsigned int j = 0; j < fe.n_dofs_per_cell(); ++j)
+ *             cell_matrix(i, j) += fe_values.shape_grad(i, q) *
+ *                                  fe_values.shape_grad(j, q) *
+ *                                  fe_values.JxW(q);
+ *
+ *       // ... and distribute the entries of lane v for cells[batch + v]
+ *     }
+ * @endcode
+ *
+ * The geometry of each cell is described by the $d$-linear interpolation of
+ * its vertices, i.e., the results are the same as those of FEValues used
+ * with a MappingQ object of degree one. Consequently, the class can only be
+ * used with such a mapping (the constructor taking a mapping throws an
+ * exception for any other one) and on cells that are straight-sided: reinit()
+ * throws an exception if a cell or one of its faces or edges has a manifold
+ * id other than numbers::flat_manifold_id, since curved manifold
+ * descriptions would be silently ignored otherwise.
+ *
+ * The class supports primitive finite elements whose shape functions are
+ * defined on the reference cell and mapped by the chain rule only, such as
+ * FE_Q, FE_DGQ, or FESystem objects composed of those, on hypercube cells.
+ *
+ * @ingroup feaccess
+ */
+template <int dim,
+          typename Number              = double,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class FEValuesBatch
+{
+public:
+  static_assert(
+    std::is_same_v<Number, typename VectorizedArrayType::value_type>,
+    "Type of Number and of VectorizedArrayType do not match.");
+
+  /**
+   * The number of cells that are processed at once.
+   */
+  static constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  /**
+   * Constructor. Precomputes the values and gradients of the shape functions
+   * and of the geometry description on the reference cell.
+   */
+  FEValuesBatch(const FiniteElement<dim> &fe,
+                const Quadrature<dim>    &quadrature,
+                const UpdateFlags         update_flags);
+
+  /**
+   * Constructor. Same as above, but checks that @p mapping describes the
+   * geometry in the same way as this class does, i.e., that it is a MappingQ
+   * object of degree one, and throws an exception otherwise.
+   */
+  FEValuesBatch(const Mapping<dim>       &mapping,
+                const FiniteElement<dim> &fe,
+                const Quadrature<dim>    &quadrature,
+                const UpdateFlags         update_flags);
+
+  /**
+   * Reinitialize the data for the cells given by @p cells. The array may
+   * contain between one and n_lanes cells; the remaining lanes are filled
+   * with a copy of the first cell, so that all arithmetic stays well-defined.
+   * Any iterator type that gives access to the vertices of a cell, such as
+   * Triangulation::cell_iterator or DoFHandler::active_cell_iterator, can be
+   * used. An exception is thrown if one of the cells is not straight-sided,
+   * see the general documentation of this class.
+   */
+  template <typename CellIteratorType>
+  void
+  reinit(const ArrayView<CellIteratorType> &cells);
+
+  /**
+   * Return the number of lanes filled by the last call to reinit().
+   */
+  unsigned int
+  n_active_lanes() const;
+
+  /**
+   * Return the value of the @p i-th shape function at quadrature point @p q.
+   * Since the shape functions are not transformed, this is a single number
+   * shared by all lanes.
+   */
+  Number
+  shape_value(const unsigned int i, const unsigned int q) const;
+
+  /**
+   * Return the gradient of the @p i-th shape function at quadrature point
+   * @p q in real space, for all cells of the batch.
+   */
+  const Tensor<1, dim, VectorizedArrayType> &
+  shape_grad(const unsigned int i, const unsigned int q) const;
+
+  /**
+   * Return the gradient of the @p i-th shape function at quadrature point
+   * @p q in real space for the cell in lane @p lane.
+   */
+  Tensor<1, dim, Number>
+  shape_grad(const unsigned int i,
+             const unsigned int q,
+             const unsigned int lane) const;
+
+  /**
+   * Return the mapped quadrature weight, i.e., the determinant of the
+   * Jacobian times the quadrature weight, at quadrature point @p q. The
+   * value for an individual cell is obtained by <code>JxW(q)[lane]</code>.
+   */
+  const VectorizedArrayType &
+  JxW(const unsigned int q) const;
+
+  /**
+   * Return the Jacobian of the transformation from the reference to the
+   * real cell at quadrature point @p q.
+   */
+  const Tensor<2, dim, VectorizedArrayType> &
+  jacobian(const unsigned int q) const;
+
+  /**
+   * Return the inverse of the Jacobian at quadrature point @p q.
+   */
+  const Tensor<2, dim, VectorizedArrayType> &
+  inverse_jacobian(const unsigned int q) const;
+
+  /**
+   * Return the location of quadrature point @p q in real space.
+   */
+  const Point<dim, VectorizedArrayType> &
+  quadrature_point(const unsigned int q) const;
+
+  /**
+   * Return the location of quadrature point @p q in real space for the cell
+   * in lane @p lane.
+   */
+  Point<dim, Number>
+  quadrature_point(const unsigned int q, const unsigned int lane) const;
+
+  /**
+   * Number of shape functions per cell.
+   */
+  const unsigned int dofs_per_cell;
+
+  /**
+   * Number of quadrature points per cell.
+   */
+  const unsigned int n_quadrature_points;
+
+private:
+  /**
+   * Return whether the cell @p cell as well as all of its faces and, in 3d,
+   * edges are described by a flat manifold.
+   */
+  template <typename CellIteratorType>
+  static bool
+  is_straight_sided(const CellIteratorType &cell);
+
+  /**
+   * The update flags, extended by the flags needed to compute the requested
+   * quantities.
+   */
+  const UpdateFlags update_flags;
+
+  /**
+   * Quadrature weights on the reference cell.
+   */
+  std::vector<Number> weights;
+
+  /**
+   * Values of the shape functions on the reference cell, with index
+   * <code>i * n_quadrature_points + q</code>.
+   */
+  std::vector<Number> reference_shape_values;
+
+  /**
+   * Gradients of the shape functions on the reference cell, with the same
+   * indexing as reference_shape_values.
+   */
+  std::vector<Tensor<1, dim, Number>> reference_shape_gradients;
+
+  /**
+   * Values of the $d$-linear geometry shape functions at the quadrature
+   * points, with index <code>v * n_quadrature_points + q</code>.
+   */
+  std::vector<Number> geometry_values;
+
+  /**
+   * Gradients of the $d$-linear geometry shape functions at the quadrature
+   * points, with the same indexing as geometry_values.
+   */
+  std::vector<Tensor<1, dim, Number>> geometry_gradients;
+
+  /**
+   * Number of lanes filled by the last call to reinit().
+   */
+  unsigned int n_filled_lanes;
+
+  /**
+   * Real-space data for the current batch of cells.
+   */
+  std::vector<Tensor<2, dim, VectorizedArrayType>> jacobians;
+  std::vector<Tensor<2, dim, VectorizedArrayType>> inverse_jacobians;
+  std::vector<VectorizedArrayType>                 JxW_values;
+  std::vector<Point<dim, VectorizedArrayType>>     quadrature_points;
+  std::vector<Tensor<1, dim, VectorizedArrayType>> shape_gradients;
+};
+
+
+
+/*---------------------------- inline functions -----------------------------*/
+
+#ifndef DOXYGEN
+
+template <int dim, typename Number, typename VectorizedArrayType>
+FEValuesBatch<dim, Number, VectorizedArrayType>::FEValuesBatch(
+  const FiniteElement<dim> &fe,
+  const Quadrature<dim>    &quadrature,
+  const UpdateFlags         update_flags_in)
+  : dofs_per_cell(fe.n_dofs_per_cell())
+  , n_quadrature_points(quadrature.size())
+  , update_flags(
+      update_flags_in |
+      ((update_flags_in & (update_gradients | update_JxW_values |
+                           update_inverse_jacobians)) ?
+         update_jacobians :
+         update_default) |
+      ((update_flags_in & update_gradients) ? update_inverse_jacobians :
+                                              update_default))
+  , n_filled_lanes(0)
+{
+  AssertThrow(fe.reference_cell().is_hyper_cube(), ExcNotImplemented());
+  AssertThrow(fe.is_primitive(),
+              ExcMessage("FEValuesBatch only supports primitive elements."));
+
+  weights.resize(n_quadrature_points);
+  for (unsigned int q = 0; q < n_quadrature_points; ++q)
+    weights[q] = quadrature.weight(q);
+
+  if (update_flags & update_values)
+    {
+      reference_shape_values.resize(dofs_per_cell * n_quadrature_points);
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        for (unsigned int q = 0; q < n_quadrature_points; ++q)
+          reference_shape_values[i * n_quadrature_points + q] =
+            fe.shape_value(i, quadrature.point(q));
+    }
+
+  if (update_flags & update_gradients)
+    {
+      reference_shape_gradients.resize(dofs_per_cell * n_quadrature_points);
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        for (unsigned int q = 0; q < n_quadrature_points; ++q)
+          reference_shape_gradients[i * n_quadrature_points + q] =
+            fe.shape_grad(i, quadrature.point(q));
+    }
+
+  constexpr unsigned int n_vertices = GeometryInfo<dim>::vertices_per_cell;
+  geometry_values.resize(n_vertices * n_quadrature_points);
+  geometry_gradients.resize(n_vertices * n_quadrature_points);
+  for (unsigned int v = 0; v < n_vertices; ++v)
+    for (unsigned int q = 0; q < n_quadrature_points; ++q)
+      {
+        geometry_values[v * n_quadrature_points + q] =
+          GeometryInfo<dim>::d_linear_shape_function(quadrature.point(q), v);
+        geometry_gradients[v * n_quadrature_points + q] =
+          GeometryInfo<dim>::d_linear_shape_function_gradient(
+            quadrature.point(q), v);
+      }
+
+  if (update_flags & update_jacobians)
+    jacobians.resize(n_quadrature_points);
+  if (update_flags & update_inverse_jacobians)
+    inverse_jacobians.resize(n_quadrature_points);
+  if (update_flags & update_JxW_values)
+    JxW_values.resize(n_quadrature_points);
+  if (update_flags & update_quadrature_points)
+    quadrature_points.resize(n_quadrature_points);
+  if (update_flags & update_gradients)
+    shape_gradients.resize(dofs_per_cell * n_quadrature_points);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+FEValuesBatch<dim, Number, VectorizedArrayType>::FEValuesBatch(
+  const Mapping<dim>       &mapping,
+  const FiniteElement<dim> &fe,
+  const Quadrature<dim>    &quadrature,
+  const UpdateFlags         update_flags)
+  : FEValuesBatch(fe, quadrature, update_flags)
+{
+  const MappingQ<dim> *mapping_q = dynamic_cast<const MappingQ<dim> *>(&mapping);
+  AssertThrow(mapping_q != nullptr && mapping_q->get_degree() == 1,
+              ExcMessage("FEValuesBatch describes the geometry by the "
+                         "d-linear interpolation of the vertices and can "
+                         "therefore only be used with a MappingQ object of "
+                         "degree one."));
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename CellIteratorType>
+bool
+FEValuesBatch<dim, Number, VectorizedArrayType>::is_straight_sided(
+  const CellIteratorType &cell)
+{
+  if (cell->manifold_id() != numbers::flat_manifold_id)
+    return false;
+
+  if constexpr (dim > 1)
+    for (const unsigned int f : cell->face_indices())
+      if (cell->face(f)->manifold_id() != numbers::flat_manifold_id)
+        return false;
+
+  if constexpr (dim == 3)
+    for (const unsigned int l : cell->line_indices())
+      if (cell->line(l)->manifold_id() != numbers::flat_manifold_id)
+        return false;
+
+  return true;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename CellIteratorType>
+void
+FEValuesBatch<dim, Number, VectorizedArrayType>::reinit(
+  const ArrayView<CellIteratorType> &cells)
+{
+  Assert(cells.size() > 0 && cells.size() <= n_lanes,
+         ExcIndexRange(cells.size(), 1, n_lanes + 1));
+  n_filled_lanes = cells.size();
+
+  for (unsigned int lane = 0; lane < n_filled_lanes; ++lane)
+    AssertThrow(is_straight_sided(cells[lane]),
+                ExcMessage("FEValuesBatch only supports straight-sided cells, "
+                           "but a cell or one of its faces or edges is "
+                           "associated with a manifold other than the flat "
+                           "one."));
+
+  // gather the vertices of all cells into vectorized points; unused lanes
+  // get the vertices of the first cell
+  constexpr unsigned int n_vertices = GeometryInfo<dim>::vertices_per_cell;
+  std::array<Point<dim, VectorizedArrayType>, n_vertices> vertices;
+  for (unsigned int lane = 0; lane < n_lanes; ++lane)
+    {
+      const auto &cell = cells[lane < n_filled_lanes ? lane : 0];
+      for (unsigned int v = 0; v < n_vertices; ++v)
+        {
+          const Point<dim> vertex = cell->vertex(v);
+          for (unsigned int d = 0; d < dim; ++d)
+            vertices[v][d][lane] = vertex[d];
+        }
+    }
+
+  for (unsigned int q = 0; q < n_quadrature_points; ++q)
+    {
+      if (update_flags & update_quadrature_points)
+        {
+          Point<dim, VectorizedArrayType> point;
+          for (unsigned int v = 0; v < n_vertices; ++v)
+            point += geometry_values[v * n_quadrature_points + q] *
+                     vertices[v];
+          quadrature_points[q] = point;
+        }
+
+      if (update_flags & update_jacobians)
+        {
+          Tensor<2, dim, VectorizedArrayType> jacobian;
+          for (unsigned int v = 0; v < n_vertices; ++v)
+            for (unsigned int d = 0; d < dim; ++d)
+              for (unsigned int e = 0; e < dim; ++e)
+                jacobian[d][e] +=
+                  vertices[v][d] *
+                  geometry_gradients[v * n_quadrature_points + q][e];
+          jacobians[q] = jacobian;
+
+          if (update_flags & update_JxW_values)
+            JxW_values[q] = determinant(jacobian) * weights[q];
+
+          if (update_flags & update_inverse_jacobians)
+            inverse_jacobians[q] = invert(jacobian);
+        }
+    }
+
+  // transform the gradients of the shape functions with the inverse
+  // transpose of the Jacobian
+  if (update_flags & update_gradients)
+    for (unsigned int i = 0; i < dofs_per_cell; ++i)
+      for (unsigned int q = 0; q < n_quadrature_points; ++q)
+        {
+          const Tensor<1, dim, Number> &reference_gradient =
+            reference_shape_gradients[i * n_quadrature_points + q];
+          Tensor<1, dim, VectorizedArrayType> &gradient =
+            shape_gradients[i * n_quadrature_points + q];
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              VectorizedArrayType sum = inverse_jacobians[q][0][d] *
+                                        reference_gradient[0];
+              for (unsigned int e = 1; e < dim; ++e)
+                sum += inverse_jacobians[q][e][d] * reference_gradient[e];
+              gradient[d] = sum;
+            }
+        }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline unsigned int
+FEValuesBatch<dim, Number, VectorizedArrayType>::n_active_lanes() const
+{
+  return n_filled_lanes;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline Number
+FEValuesBatch<dim, Number, VectorizedArrayType>::shape_value(
+  const unsigned int i,
+  const unsigned int q) const
+{
+  Assert(update_flags & update_values,
+         ExcMessage("You need to set update_values to access shape values."));
+  AssertIndexRange(i, dofs_per_cell);
+  AssertIndexRange(q, n_quadrature_points);
+  return reference_shape_values[i * n_quadrature_points + q];
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const Tensor<1, dim, VectorizedArrayType> &
+FEValuesBatch<dim, Number, VectorizedArrayType>::shape_grad(
+  const unsigned int i,
+  const unsigned int q) const
+{
+  Assert(update_flags & update_gradients,
+         ExcMessage(
+           "You need to set update_gradients to access shape gradients."));
+  AssertIndexRange(i, dofs_per_cell);
+  AssertIndexRange(q, n_quadrature_points);
+  return shape_gradients[i * n_quadrature_points + q];
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline Tensor<1, dim, Number>
+FEValuesBatch<dim, Number, VectorizedArrayType>::shape_grad(
+  const unsigned int i,
+  const unsigned int q,
+  const unsigned int lane) const
+{
+  AssertIndexRange(lane, n_filled_lanes);
+  const Tensor<1, dim, VectorizedArrayType> &gradient = shape_grad(i, q);
+  Tensor<1, dim, Number>                     result;
+  for (unsigned int d = 0; d < dim; ++d)
+    result[d] = gradient[d][lane];
+  return result;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const VectorizedArrayType &
+FEValuesBatch<dim, Number, VectorizedArrayType>::JxW(const unsigned int q) const
+{
+  Assert(update_flags & update_JxW_values,
+         ExcMessage("You need to set update_JxW_values to access JxW."));
+  AssertIndexRange(q, n_quadrature_points);
+  return JxW_values[q];
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const Tensor<2, dim, VectorizedArrayType> &
+FEValuesBatch<dim, Number, VectorizedArrayType>::jacobian(
+  const unsigned int q) const
+{
+  Assert(update_flags & update_jacobians,
+         ExcMessage("You need to set update_jacobians to access Jacobians."));
+  AssertIndexRange(q, n_quadrature_points);
+  return jacobians[q];
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const Tensor<2, dim, VectorizedArrayType> &
+FEValuesBatch<dim, Number, VectorizedArrayType>::inverse_jacobian(
+  const unsigned int q) const
+{
+  Assert(update_flags & update_inverse_jacobians,
+         ExcMessage("You need to set update_inverse_jacobians to access "
+                    "inverse Jacobians."));
+  AssertIndexRange(q, n_quadrature_points);
+  return inverse_jacobians[q];
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const Point<dim, VectorizedArrayType> &
+FEValuesBatch<dim, Number, VectorizedArrayType>::quadrature_point(
+  const unsigned int q) const
+{
+  Assert(update_flags & update_quadrature_points,
+         ExcMessage("You need to set update_quadrature_points to access "
+                    "quadrature points."));
+  AssertIndexRange(q, n_quadrature_points);
+  return quadrature_points[q];
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline Point<dim, Number>
+FEValuesBatch<dim, Number, VectorizedArrayType>::quadrature_point(
+  const unsigned int q,
+  const unsigned int lane) const
+{
+  AssertIndexRange(lane, n_filled_lanes);
+  const Point<dim, VectorizedArrayType> &point = quadrature_point(q);
+  Point<dim, Number>                     result;
+  for (unsigned int d = 0; d < dim; ++d)
+    result[d] = point[d][lane];
+  return result;
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
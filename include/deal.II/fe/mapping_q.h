@@ -638,6 +638,19 @@ protected:
     const Point<spacedim>                                      &p,
     const Point<dim> &initial_p_unit) const;
 
+  /**
+   * Implementation of transform_points_real_to_unit_cell() for
+   * dim==spacedim-1, given the mapping support points of the cell. The
+   * points are transformed in batches of VectorizedArray<double>::size()
+   * points. Points for which the Newton iteration fails are marked by an
+   * infinite first coordinate.
+   */
+  void
+  transform_points_real_to_unit_cell_codim1(
+    const ArrayView<const Point<spacedim>> &support_points,
+    const ArrayView<const Point<spacedim>> &real_points,
+    const ArrayView<Point<dim>>            &unit_points) const;
+
   /**
    * Append the support points of all shape functions located on bounding
    * lines of the given cell to the vector @p a. Points located on the
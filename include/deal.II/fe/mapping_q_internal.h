@@ -41,6 +41,7 @@
 
 #include <array>
 #include <limits>
+#include <type_traits>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -727,13 +728,19 @@ namespace internal
 
 
     /**
-     * Implementation of transform_real_to_unit_cell for dim==spacedim-1
+     * Implementation of transform_real_to_unit_cell for dim==spacedim-1 for
+     * either type double or VectorizedArray<double>. For type double, an
+     * exception is thrown if the Newton iteration does not converge. For
+     * VectorizedArray<double>, the first component of the returned point is
+     * set to infinity on the SIMD lanes that did not converge, so that the
+     * caller can repeat the computation for these lanes with scalar
+     * arguments.
      */
-    template <int dim>
-    inline Point<dim>
+    template <int dim, typename Number = double>
+    inline Point<dim, Number>
     do_transform_real_to_unit_cell_internal_codim1(
-      const Point<dim + 1>                               &p,
-      const Point<dim>                                   &initial_p_unit,
+      const Point<dim + 1, Number>                       &p,
+      const Point<dim, Number>                           &initial_p_unit,
       const ArrayView<const Point<dim + 1>>              &points,
       const std::vector<Polynomials::Polynomial<double>> &polynomials_1d,
       const std::vector<unsigned int>                    &renumber)
@@ -743,15 +750,18 @@ namespace internal
       AssertDimension(points.size(),
                       Utilities::pow(polynomials_1d.size(), dim));
 
-      Point<dim> p_unit = initial_p_unit;
+      Point<dim, Number> p_unit = initial_p_unit;
 
       const double       eps        = 1.e-12;
       const unsigned int loop_limit = 10;
 
       unsigned int loop                   = 0;
-      double       f_weighted_norm_square = 1.;
+      Number       f_weighted_norm_square = 1.;
 
-      while (f_weighted_norm_square > eps * eps && loop++ < loop_limit)
+      // iterate until f_weighted_norm_square <= eps^2 on all SIMD lanes
+      while (!(std::max(f_weighted_norm_square - eps * eps, Number(0.)) ==
+               Number(0.)) &&
+             loop++ < loop_limit)
         {
           const auto p_real =
             internal::evaluate_tensor_product_value_and_gradient(
@@ -760,13 +770,13 @@ namespace internal
               p_unit,
               polynomials_1d.size() == 2,
               renumber);
-          Tensor<1, spacedim>                    p_minus_F = p - p_real.first;
-          const DerivativeForm<1, spacedim, dim> DF        = p_real.second;
+          const Tensor<1, spacedim, Number> p_minus_F = p - p_real.first;
+          const auto                       &DF        = p_real.second;
 
           const auto hessian = internal::evaluate_tensor_product_hessian(
             polynomials_1d, points, p_unit, renumber);
-          Point<dim>     f;
-          Tensor<2, dim> df;
+          Tensor<1, dim, Number> f;
+          Tensor<2, dim, Number> df;
           for (unsigned int j = 0; j < dim; ++j)
             {
               f[j] = DF[j] * p_minus_F;
@@ -775,19 +785,29 @@ namespace internal
             }
 
           // Solve  [df(x)]d=f(x)
-          const Tensor<1, dim> d =
-            invert(df) * static_cast<const Tensor<1, dim> &>(f);
-          f_weighted_norm_square = d.norm_square();
+          const Tensor<1, dim, Number> d = invert(df) * f;
+          f_weighted_norm_square         = d.norm_square();
           p_unit -= d;
         }
 
-
-      // Here we check that in the last execution of while the first
-      // condition was already wrong, meaning the residual was below
-      // eps. Only if the first condition failed, loop will have been
-      // increased and tested, and thus have reached the limit.
-      AssertThrow(loop < loop_limit,
-                  (typename Mapping<dim, spacedim>::ExcTransformationFailed()));
+      if constexpr (std::is_same_v<Number, double>)
+        {
+          // Here we check that in the last execution of while the first
+          // condition was already wrong, meaning the residual was below
+          // eps. Only if the first condition failed, loop will have been
+          // increased and tested, and thus have reached the limit.
+          AssertThrow(loop < loop_limit,
+                      (typename Mapping<dim, spacedim>::
+                         ExcTransformationFailed()));
+        }
+      else
+        {
+          // Mark the lanes whose residual is not below eps, including those
+          // that ran into a singular matrix
+          for (unsigned int v = 0; v < Number::size(); ++v)
+            if (!(f_weighted_norm_square[v] <= eps * eps))
+              p_unit[0][v] = std::numeric_limits<double>::infinity();
+        }
 
       return p_unit;
     }
@@ -1243,6 +1243,43 @@ namespace GridTools
     const std::vector<bool> &marked_vertices = {},
     const double             tolerance       = 1.e-10);
 
+  /**
+   * Find the active non-artificial cells around many points at once. The
+   * result is the same as if find_active_cell_around_point() had been called
+   * for each element of @p points, i.e., the $i$th entry of the returned
+   * vector contains the cell around `points[i]` and the location of the point
+   * in the reference coordinates of that cell, or an iterator to the end of
+   * the triangulation if no cell was found. For points located on the
+   * boundary between two or more cells, any of these cells may be returned.
+   *
+   * For large sets of points, this function is much faster than calling
+   * find_active_cell_around_point() in a loop:
+   * - The points are processed in the order of a Hilbert space-filling curve
+   *   through their locations, so that consecutive points tend to lie in the
+   *   same or in neighboring cells. The cell found for one point is used as
+   *   the hint for the next.
+   * - Consecutive points are first tested in batches against the cell found
+   *   for the previous point via Mapping::transform_points_real_to_unit_cell(),
+   *   which runs the Newton iteration for the inverse mapping of MappingQ
+   *   vectorized over several points. Only the points that turn out not to be
+   *   inside this cell are located individually.
+   * - Points that are far away from the bounding boxes of all cells (see
+   *   GridTools::Cache::get_cell_bounding_boxes_rtree()) are identified as
+   *   lying outside of the mesh without visiting the cells.
+   * - The work is split among several threads, see
+   *   @ref threads "Parallel computing with multiple processors".
+   *
+   * All data structures of @p cache needed by the search are built before the
+   * threads are started.
+   */
+  template <int dim, int spacedim>
+  std::vector<
+    std::pair<typename Triangulation<dim, spacedim>::active_cell_iterator,
+              Point<dim>>>
+  find_active_cells_around_points(const Cache<dim, spacedim>         &cache,
+                                  const std::vector<Point<spacedim>> &points,
+                                  const double tolerance = 1.e-10);
+
   /**
    * A version of the previous function that exploits an already existing
    * map between vertices and cells (constructed using the function
@@ -1988,6 +2025,26 @@ namespace GridTools
                                  Triangulation<dim, spacedim> &triangulation,
                                  const bool group_siblings = true);
 
+  /**
+   * Generate a partitioning of the active cells by sorting them along a
+   * Hilbert space filling curve through the cell centers (see
+   * Utilities::inverse_Hilbert_space_filling_curve()) and cutting the
+   * resulting sequence into @p n_partitions contiguous pieces of (almost)
+   * equal size. After calling this function, the subdomain ids of all active
+   * cells will have values between zero and @p n_partitions-1.
+   *
+   * In contrast to partition_triangulation_zorder(), this function does not
+   * depend on the refinement hierarchy and the ordering of the coarse cells,
+   * and in contrast to partition_triangulation() it does not need METIS or
+   * Zoltan nor a cell connectivity graph. It is therefore a cheap alternative
+   * for large unstructured (e.g., simplex) meshes. Its cost is dominated by
+   * sorting the active cells.
+   */
+  template <int dim, int spacedim>
+  void
+  partition_triangulation_hilbert(const unsigned int            n_partitions,
+                                  Triangulation<dim, spacedim> &triangulation);
+
   /**
    * Partitions the cells of a multigrid hierarchy by assigning level subdomain
    * ids using the "youngest child" rule, that is, each cell in the hierarchy is
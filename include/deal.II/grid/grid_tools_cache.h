@@ -35,6 +35,7 @@
 
 #include <atomic>
 #include <cmath>
+#include <vector>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -53,14 +54,19 @@ namespace GridTools
    *
    * Notice that this class only notices if the underlying Triangulation has
    * changed due to a Triangulation::Signals::any_change() signal being
-   * triggered.
+   * triggered. If the vertices have only been moved, i.e., the signal was
+   * triggered through Triangulation::Signals::mesh_movement(), only the
+   * data structures that depend on the locations of the vertices are
+   * recomputed, see GridTools::update_geometry, while those that only depend
+   * on the connectivity of the mesh are kept.
    *
    * If the triangulation changes for other reasons, for example because you
    * use it in conjunction with a MappingQEulerian object that sees the
    * vertices through its own transformation, or because you manually change
    * some vertex locations, then some of the structures in this class become
    * obsolete, and you will have to mark them as outdated, by calling the
-   * method mark_for_update() manually.
+   * method mark_for_update() manually. In the first two cases, calling
+   * `mark_for_update(GridTools::update_geometry)` is sufficient.
    */
   template <int dim, int spacedim = dim>
   class Cache : public Subscriptor
@@ -327,9 +333,9 @@ namespace GridTools
     mutable std::mutex vertices_with_ghost_neighbors_mutex;
 
     /**
-     * Storage for the status of the triangulation signal.
+     * Storage for the status of the triangulation signals.
      */
-    boost::signals2::connection tria_signal;
+    std::vector<boost::signals2::connection> tria_signals;
   };
 
 
@@ -89,6 +89,25 @@ namespace GridTools
      */
     update_vertex_with_ghost_neighbors = 0x200,
 
+    /**
+     * Update all objects that depend on the locations of the vertices, but
+     * not on the connectivity of the mesh: the
+     * vertex_to_cell_centers_directions, the used vertices and their RTree,
+     * and all RTree objects of bounding boxes. The vertex_to_cell_map and the
+     * information about neighboring subdomains are kept.
+     *
+     * This is what needs to be updated after the vertices have been moved
+     * (which the Cache detects through the
+     * Triangulation::Signals::mesh_movement signal), or after the mapping
+     * used by the Cache has changed, for example a MappingQEulerian object
+     * whose displacement vector has been updated.
+     */
+    update_geometry =
+      (update_vertex_to_cell_centers_directions & ~update_vertex_to_cell_map) |
+      update_used_vertices | update_used_vertices_rtree |
+      update_cell_bounding_boxes_rtree | update_covering_rtree |
+      update_locally_owned_cell_bounding_boxes_rtree,
+
     /**
      * Update all objects.
      */
@@ -296,36 +296,41 @@ namespace internal
 
   /**
    * Copy data from the local_face_integrals map of a single ParallelData
-   * object into a global such map. This is the copier stage of a WorkStream
+   * object into a global array. This is the copier stage of a WorkStream
    * pipeline.
+   *
+   * The global array stores the integrals of all solution vectors for the
+   * face with index <tt>f</tt> in the entries starting at
+   * <tt>f*n_solution_vectors</tt>. Entries of faces that have not been
+   * computed (yet) are negative.
    */
   template <int dim, int spacedim>
   void
   copy_local_to_global(
     const std::map<typename DoFHandler<dim, spacedim>::face_iterator,
                    std::vector<double>> &local_face_integrals,
-    std::map<typename DoFHandler<dim, spacedim>::face_iterator,
-             std::vector<double>>       &face_integrals)
+    const unsigned int                   n_solution_vectors,
+    std::vector<double>                 &face_integrals)
   {
-    // now copy locally computed elements into the global map
-    for (typename std::map<typename DoFHandler<dim, spacedim>::face_iterator,
-                           std::vector<double>>::const_iterator p =
-           local_face_integrals.begin();
-         p != local_face_integrals.end();
-         ++p)
+    // now copy locally computed elements into the global array
+    for (const auto &p : local_face_integrals)
       {
-        // double check that the element does not already exists in the
-        // global map
-        Assert(face_integrals.find(p->first) == face_integrals.end(),
+        AssertDimension(p.second.size(), n_solution_vectors);
+        const std::size_t offset =
+          static_cast<std::size_t>(p.first->index()) * n_solution_vectors;
+
+        // double check that the element has not already been written into
+        // the global array
+        Assert(n_solution_vectors == 0 || face_integrals[offset] < 0,
                ExcInternalError());
 
-        for (unsigned int i = 0; i < p->second.size(); ++i)
+        for (unsigned int i = 0; i < n_solution_vectors; ++i)
           {
-            Assert(numbers::is_finite(p->second[i]), ExcInternalError());
-            Assert(p->second[i] >= 0, ExcInternalError());
-          }
+            Assert(numbers::is_finite(p.second[i]), ExcInternalError());
+            Assert(p.second[i] >= 0, ExcInternalError());
 
-        face_integrals[p->first] = p->second;
+            face_integrals[offset + i] = p.second[i];
+          }
       }
   }
 
@@ -1203,13 +1208,18 @@ KellyErrorEstimator<dim, spacedim>::estimate(
 
   const unsigned int n_solution_vectors = solutions.size();
 
-  // Map of integrals indexed by the corresponding face. In this map we store
-  // the integrated jump of the gradient for each face.  At the end of the
-  // function, we again loop over the cells and collect the contributions of
-  // the different faces of the cell.
-  std::map<typename DoFHandler<dim, spacedim>::face_iterator,
-           std::vector<double>>
-    face_integrals;
+  // Array of integrals indexed by the index of the corresponding face (and
+  // the solution vector). In this array we store the integrated jump of the
+  // gradient for each face. Each face is integrated only once, and at the end
+  // of the function, we loop over the cells and add the contributions of each
+  // face to both of the cells adjacent to it. Using the face index rather
+  // than a std::map keyed by face iterators avoids the logarithmic lookups
+  // both in the copier and in the final summation, and the initial value -1
+  // marks faces for which nothing has been computed.
+  std::vector<double> face_integrals(
+    static_cast<std::size_t>(dof_handler.get_triangulation().n_raw_faces()) *
+      n_solution_vectors,
+    -1.);
 
   // all the data needed in the error estimator by each of the threads is
   // gathered in the following structures
@@ -1242,10 +1252,11 @@ KellyErrorEstimator<dim, spacedim>::estimate(
       internal::estimate_one_cell(
         cell, parallel_data, local_face_integrals, solutions, strategy);
     },
-    [&face_integrals](
+    [&face_integrals, n_solution_vectors](
       const std::map<typename DoFHandler<dim, spacedim>::face_iterator,
                      std::vector<double>> &local_face_integrals) {
       internal::copy_local_to_global<dim, spacedim>(local_face_integrals,
+                                                    n_solution_vectors,
                                                     face_integrals);
     },
     parallel_data,
@@ -1276,9 +1287,9 @@ KellyErrorEstimator<dim, spacedim>::estimate(
         // loop over all faces of this cell
         for (const unsigned int face_no : cell->face_indices())
           {
-            Assert(face_integrals.find(cell->face(face_no)) !=
-                     face_integrals.end(),
-                   ExcInternalError());
+            const std::size_t offset =
+              static_cast<std::size_t>(cell->face_index(face_no)) *
+              n_solution_vectors;
             const double factor = internal::cell_factor<dim, spacedim>(
               cell, face_no, dof_handler, strategy);
 
@@ -1286,11 +1297,10 @@ KellyErrorEstimator<dim, spacedim>::estimate(
               {
                 // make sure that we have written a meaningful value into this
                 // slot
-                Assert(face_integrals[cell->face(face_no)][n] >= 0,
-                       ExcInternalError());
+                Assert(face_integrals[offset + n] >= 0, ExcInternalError());
 
                 (*errors[n])(present_cell) +=
-                  (face_integrals[cell->face(face_no)][n] * factor);
+                  (face_integrals[offset + n] * factor);
               }
           }
 
@@ -25,13 +25,17 @@
 #include <deal.II/dofs/dof_accessor.h>
 #include <deal.II/dofs/dof_handler.h>
 
+#include <deal.II/fe/fe_update_flags.h>
 #include <deal.II/fe/mapping_q1.h>
 
 #include <deal.II/grid/grid_tools_cache.h>
 
 #include <deal.II/lac/vector.h>
 
+#include <array>
+#include <memory>
 #include <optional>
+#include <vector>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -42,6 +46,15 @@ namespace VectorTools
 {
   class ExcPointNotAvailableHere;
 }
+
+template <int n_components_, int dim, int spacedim, typename Number>
+class FEPointEvaluation;
+
+namespace NonMatching
+{
+  template <int dim, int spacedim, typename Number>
+  class MappingInfo;
+}
 #endif
 
 namespace Functions
@@ -122,6 +135,21 @@ namespace Functions
    * tell where your points are, you will save a lot of computational time by
    * letting this class know.
    *
+   * The functions that evaluate the function at a list of points, such as
+   * vector_value_list() and vector_gradient_list(), first sort the points
+   * into the cells that contain them, and then evaluate the finite element
+   * function on each cell at all points inside it at once with
+   * FEPointEvaluation. For the common case of FE_Q or FE_DGQ elements
+   * (possibly within an FESystem), this uses fast tensor product kernels
+   * rather than a new FEValues object for each cell. They should therefore
+   * be preferred over the functions for single points. This is the case,
+   * e.g., for VectorTools::interpolate(), which evaluates the function at
+   * all support points of a cell with one call to vector_value_list().
+   *
+   * The last cell in which a point was found, as well as the objects used
+   * for the evaluation, are stored separately for each thread, so the same
+   * object can be used concurrently from several threads.
+   *
    *
    * <h3>Using FEFieldFunction with parallel::distributed::Triangulation</h3>
    *
@@ -449,6 +477,29 @@ namespace Functions
     using cell_hint_t = Threads::ThreadLocalStorage<
       typename DoFHandler<dim, spacedim>::active_cell_iterator>;
 
+    /**
+     * Typedef for the objects that evaluate a single component of the
+     * finite element function at arbitrary points of a cell. They are only
+     * used for real-valued vectors.
+     */
+    using point_evaluator_t = FEPointEvaluation<
+      1,
+      dim,
+      dim,
+      typename numbers::NumberTraits<
+        typename VectorType::value_type>::real_type>;
+
+    /**
+     * Typedef for the objects that hold the mapping data of the points
+     * located in a cell, which are shared by all objects of type
+     * point_evaluator_t.
+     */
+    using mapping_info_t = NonMatching::MappingInfo<
+      dim,
+      dim,
+      typename numbers::NumberTraits<
+        typename VectorType::value_type>::real_type>;
+
     /**
      * Pointer to the dof handler.
      */
@@ -476,6 +527,46 @@ namespace Functions
      */
     mutable cell_hint_t cell_hint;
 
+    /**
+     * The mapping data of the points located in a cell, for the evaluation
+     * of values and of gradients, created on demand by get_mapping_info(),
+     * separately for each thread.
+     */
+    mutable Threads::ThreadLocalStorage<
+      std::array<std::shared_ptr<mapping_info_t>, 2>>
+      mapping_infos;
+
+    /**
+     * The objects used to evaluate the components of the finite element
+     * function at the points located in a cell, created on demand by
+     * get_point_evaluator(), separately for each thread.
+     */
+    mutable Threads::ThreadLocalStorage<
+      std::vector<std::shared_ptr<point_evaluator_t>>>
+      point_evaluators;
+
+    /**
+     * Return the mapping data of the current thread for the evaluation of
+     * values (if @p update_flags is update_values) or gradients (if
+     * @p update_flags is update_gradients).
+     */
+    mapping_info_t &
+    get_mapping_info(const UpdateFlags update_flags) const;
+
+    /**
+     * Return the object of the current thread that evaluates the values
+     * (if @p update_flags is update_values) or the gradients (if
+     * @p update_flags is update_gradients) of the component @p component
+     * of the finite element function on cells with the active finite
+     * element index @p active_fe_index. It uses the data of
+     * get_mapping_info() with the same @p update_flags, so that the mapping
+     * only needs to be evaluated once per cell for all components.
+     */
+    point_evaluator_t &
+    get_point_evaluator(const unsigned int active_fe_index,
+                        const unsigned int component,
+                        const UpdateFlags  update_flags) const;
+
     /**
      * Given a cell, return the reference coordinates of the given point
      * within this cell if it indeed lies within the cell. Otherwise return an
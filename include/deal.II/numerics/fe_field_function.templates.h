@@ -28,15 +28,54 @@
 #include <deal.II/hp/mapping_collection.h>
 #include <deal.II/hp/q_collection.h>
 
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+#include <deal.II/non_matching/mapping_info.h>
+
 #include <deal.II/numerics/fe_field_function.h>
 #include <deal.II/numerics/vector_tools_common.h>
 
 #include <tuple>
+#include <type_traits>
 
 
 
 DEAL_II_NAMESPACE_OPEN
 
+namespace internal
+{
+  namespace FEFieldFunctionImplementation
+  {
+    /**
+     * Return whether FEPointEvaluation can evaluate all components of all
+     * elements of @p fe_collection with @p mapping through its tensor-product
+     * fast path. Only then FEPointEvaluation works with a shared
+     * NonMatching::MappingInfo object and a reinit() call without arguments.
+     */
+    template <int dim, int spacedim>
+    bool
+    point_evaluation_is_supported(
+      const Mapping<dim>                            &mapping,
+      const dealii::hp::FECollection<dim, spacedim> &fe_collection)
+    {
+      if (!dealii::internal::FEPointEvaluation::is_fast_path_supported(
+            mapping))
+        return false;
+
+      for (unsigned int i = 0; i < fe_collection.size(); ++i)
+        for (unsigned int c = 0; c < fe_collection[i].n_components(); ++c)
+          if (!dealii::internal::FEPointEvaluation::is_fast_path_supported(
+                fe_collection[i],
+                fe_collection[i].component_to_base_index(c).first))
+            return false;
+
+      return true;
+    }
+  } // namespace FEFieldFunctionImplementation
+} // namespace internal
+
+
+
 namespace Functions
 {
   template <int dim, typename VectorType, int spacedim>
@@ -280,6 +319,44 @@ namespace Functions
 
     const unsigned int n_cells =
       compute_point_locations(points, cells, qpoints, maps);
+    if (n_cells > 0)
+      cell_hint.get() = cells.back();
+
+    // For real-valued vectors, evaluate all points of a cell at once with
+    // FEPointEvaluation, one component at a time. The mapping is evaluated
+    // only once per cell for all components. This requires elements and a
+    // mapping with a tensor-product structure; all others go through
+    // FEValues below
+    if constexpr (std::is_floating_point_v<typename VectorType::value_type>)
+      if (internal::FEFieldFunctionImplementation::
+            point_evaluation_is_supported(mapping, dh->get_fe_collection()))
+        {
+          std::vector<typename VectorType::value_type> solution_values;
+          for (unsigned int i = 0; i < n_cells; ++i)
+            {
+              AssertThrow(!cells[i]->is_artificial(),
+                          VectorTools::ExcPointNotAvailableHere());
+
+              solution_values.resize(cells[i]->get_fe().n_dofs_per_cell());
+              cells[i]->get_dof_values(data_vector,
+                                       solution_values.begin(),
+                                       solution_values.end());
+
+              get_mapping_info(update_values).reinit(cells[i], qpoints[i]);
+              for (unsigned int c = 0; c < this->n_components; ++c)
+                {
+                  point_evaluator_t &evaluator =
+                    get_point_evaluator(cells[i]->active_fe_index(),
+                                        c,
+                                        update_values);
+                  evaluator.reinit();
+                  evaluator.evaluate(solution_values, EvaluationFlags::values);
+                  for (unsigned int q = 0; q < qpoints[i].size(); ++q)
+                    values[maps[i][q]](c) = evaluator.get_value(q);
+                }
+            }
+          return;
+        }
 
     // Create quadrature collection
     hp::QCollection<dim> quadrature_collection;
@@ -360,6 +437,44 @@ namespace Functions
 
     const unsigned int n_cells =
       compute_point_locations(points, cells, qpoints, maps);
+    if (n_cells > 0)
+      cell_hint.get() = cells.back();
+
+    // Same as in vector_value_list()
+    if constexpr (std::is_floating_point_v<typename VectorType::value_type>)
+      if (internal::FEFieldFunctionImplementation::
+            point_evaluation_is_supported(mapping, dh->get_fe_collection()))
+        {
+          std::vector<typename VectorType::value_type> solution_values;
+          for (unsigned int i = 0; i < n_cells; ++i)
+            {
+              AssertThrow(!cells[i]->is_artificial(),
+                          VectorTools::ExcPointNotAvailableHere());
+
+              solution_values.resize(cells[i]->get_fe().n_dofs_per_cell());
+              cells[i]->get_dof_values(data_vector,
+                                       solution_values.begin(),
+                                       solution_values.end());
+
+              for (unsigned int q = 0; q < qpoints[i].size(); ++q)
+                values[maps[i][q]].resize(this->n_components);
+
+              get_mapping_info(update_gradients).reinit(cells[i], qpoints[i]);
+              for (unsigned int c = 0; c < this->n_components; ++c)
+                {
+                  point_evaluator_t &evaluator =
+                    get_point_evaluator(cells[i]->active_fe_index(),
+                                        c,
+                                        update_gradients);
+                  evaluator.reinit();
+                  evaluator.evaluate(solution_values,
+                                     EvaluationFlags::gradients);
+                  for (unsigned int q = 0; q < qpoints[i].size(); ++q)
+                    values[maps[i][q]][c] = evaluator.get_gradient(q);
+                }
+            }
+          return;
+        }
 
     // Create quadrature collection
     hp::QCollection<dim> quadrature_collection;
@@ -544,6 +659,56 @@ namespace Functions
   }
 
 
+  template <int dim, typename VectorType, int spacedim>
+  typename FEFieldFunction<dim, VectorType, spacedim>::mapping_info_t &
+  FEFieldFunction<dim, VectorType, spacedim>::get_mapping_info(
+    const UpdateFlags update_flags) const
+  {
+    Assert(update_flags == update_values || update_flags == update_gradients,
+           ExcNotImplemented());
+
+    // Keep separate objects for values and gradients, so that the mapping
+    // is only evaluated when gradients are requested
+    std::shared_ptr<mapping_info_t> &mapping_info =
+      mapping_infos.get()[update_flags == update_gradients ? 1 : 0];
+    if (mapping_info == nullptr)
+      mapping_info = std::make_shared<mapping_info_t>(mapping, update_flags);
+
+    return *mapping_info;
+  }
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  typename FEFieldFunction<dim, VectorType, spacedim>::point_evaluator_t &
+  FEFieldFunction<dim, VectorType, spacedim>::get_point_evaluator(
+    const unsigned int active_fe_index,
+    const unsigned int component,
+    const UpdateFlags  update_flags) const
+  {
+    Assert(update_flags == update_values || update_flags == update_gradients,
+           ExcNotImplemented());
+    AssertIndexRange(component, this->n_components);
+
+    const unsigned int index =
+      2 * (active_fe_index * this->n_components + component) +
+      (update_flags == update_gradients ? 1 : 0);
+
+    std::vector<std::shared_ptr<point_evaluator_t>> &evaluators =
+      point_evaluators.get();
+    if (index >= evaluators.size())
+      evaluators.resize(index + 1);
+    if (evaluators[index] == nullptr)
+      evaluators[index] =
+        std::make_shared<point_evaluator_t>(get_mapping_info(update_flags),
+                                            dh->get_fe(active_fe_index),
+                                            component);
+
+    return *evaluators[index];
+  }
+
+
+
   template <int dim, typename VectorType, int spacedim>
   std::optional<Point<dim>>
   FEFieldFunction<dim, VectorType, spacedim>::get_reference_coordinates(
@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/table.h>
 
 #include <deal.II/distributed/tria_base.h>
 
@@ -26,6 +27,7 @@
 
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/vector.h>
+#include <deal.II/lac/vector_element_access.h>
 
 #include <deal.II/matrix_free/fe_point_evaluation.h>
 
@@ -279,6 +281,125 @@ namespace VectorTools
 
 
 
+  /**
+   * A class for the repeated evaluation of finite element functions at a
+   * fixed set of points, e.g., the probes of a monitor that records the
+   * solution at some locations in every time step.
+   *
+   * The function point_values() evaluates the shape functions at the
+   * reference coordinates of the points, and reads the degrees of freedom of
+   * the cells that contain them, anew every time it is called. Since neither
+   * the points nor the mesh change between these calls, this class does all
+   * of this once in its constructor: for every point (and every cell it was
+   * found in) it stores the global indices of the degrees of freedom that
+   * contribute to the value at the point, together with the values of the
+   * associated shape functions. Evaluating a vector then only amounts to
+   * gathering and weighting these entries. Several vectors can be evaluated
+   * at once, in which case the entries are gathered for all vectors and
+   * vector components in one sweep. The values are then sent to the
+   * processes that asked for the points as arrays of plain numbers, one
+   * vector component of one vector at a time.
+   *
+   * @code
+   * Utilities::MPI::RemotePointEvaluation<dim> cache;
+   * cache.reinit(probe_locations, triangulation, mapping);
+   *
+   * const VectorTools::PointValueEvaluator<dim> probes(cache, dof_handler);
+   *
+   * // in every time step:
+   * const Table<3, double> values =
+   *   probes.evaluate(std::vector<const VectorType *>{&velocity, &pressure});
+   * // values(v, p, c) is component c of vector v at probe location p
+   * @endcode
+   *
+   * The object refers to @p cache and @p dof_handler, and needs to be set up
+   * again (by calling reinit()) whenever one of them changes, e.g., after
+   * the mesh has been refined or the degrees of freedom have been renumbered.
+   *
+   * @note The vectors to be evaluated need to provide read access to all
+   *   degrees of freedom of the locally owned cells that contain a point,
+   *   i.e., parallel vectors need to have their ghost values set.
+   *
+   * @warning The function evaluate() is a collective call that needs to be
+   *   executed by all processors in the communicator.
+   */
+  template <int dim, int spacedim = dim>
+  class PointValueEvaluator
+  {
+  public:
+    /**
+     * Constructor. Calls reinit() with the given arguments.
+     */
+    PointValueEvaluator(
+      const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &cache,
+      const DoFHandler<dim, spacedim>                            &dof_handler);
+
+    /**
+     * Compute the indices of the degrees of freedom and the shape function
+     * values that contribute to the values at the points of @p cache, which
+     * needs to have been set up with the triangulation of @p dof_handler.
+     * All finite elements used by @p dof_handler need to have the same
+     * number of vector components.
+     */
+    void
+    reinit(const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &cache,
+           const DoFHandler<dim, spacedim> &dof_handler);
+
+    /**
+     * Evaluate the given @p vectors at the points. The result is a table
+     * whose entry <tt>(v, p, c)</tt> is the value of vector component
+     * <tt>c</tt> of the finite element function represented by
+     * <tt>*vectors[v]</tt> at point <tt>p</tt>.
+     *
+     * If a point lies in several cells (e.g., on a vertex), the values
+     * computed on these cells are combined as indicated by @p flags. The
+     * values at points that have not been found are zero.
+     */
+    template <typename VectorType>
+    Table<3, typename VectorType::value_type>
+    evaluate(const std::vector<const VectorType *> &vectors,
+             const EvaluationFlags::EvaluationFlags flags =
+               EvaluationFlags::avg) const;
+
+    /**
+     * Return the number of vector components of the finite element.
+     */
+    unsigned int
+    n_components() const;
+
+  private:
+    /**
+     * Pointer to the RemotePointEvaluation object that is used for
+     * communication.
+     */
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> *cache;
+
+    /**
+     * The number of vector components.
+     */
+    unsigned int n_vector_components;
+
+    /**
+     * The sparse matrix that maps the degrees of freedom to the values at
+     * the points, stored in compressed row format. Row
+     * <tt>q*n_components()+c</tt> describes component <tt>c</tt> at the
+     * <tt>q</tt>th point-in-cell entry of the CellData object of the cache.
+     */
+    std::vector<unsigned int> row_starts;
+
+    /**
+     * The global indices of the degrees of freedom of each row.
+     */
+    std::vector<types::global_dof_index> dof_indices;
+
+    /**
+     * The values of the shape functions of each row.
+     */
+    std::vector<double> shape_values;
+  };
+
+
+
   // inlined functions
 
 
@@ -840,6 +961,171 @@ namespace VectorTools
       });
   }
 
+
+
+  template <int dim, int spacedim>
+  PointValueEvaluator<dim, spacedim>::PointValueEvaluator(
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &cache,
+    const DoFHandler<dim, spacedim>                            &dof_handler)
+    : cache(nullptr)
+    , n_vector_components(0)
+  {
+    reinit(cache, dof_handler);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  PointValueEvaluator<dim, spacedim>::reinit(
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &cache,
+    const DoFHandler<dim, spacedim>                            &dof_handler)
+  {
+    Assert(cache.is_ready(),
+           ExcMessage(
+             "Utilities::MPI::RemotePointEvaluation is not ready yet! "
+             "Please call Utilities::MPI::RemotePointEvaluation::reinit() "
+             "before setting up this object."));
+    Assert(&dof_handler.get_triangulation() == &cache.get_triangulation(),
+           ExcMessage(
+             "The provided Utilities::MPI::RemotePointEvaluation and "
+             "DoFHandler object have been set up with different "
+             "Triangulation objects, a scenario not supported!"));
+
+    this->cache = &cache;
+
+    const hp::FECollection<dim, spacedim> &fe_collection =
+      dof_handler.get_fe_collection();
+    n_vector_components = fe_collection.n_components();
+
+    row_starts.clear();
+    dof_indices.clear();
+    shape_values.clear();
+    row_starts.push_back(0);
+
+    const auto &cell_data = cache.get_cell_data();
+
+    std::vector<types::global_dof_index> local_dof_indices;
+    for (const auto i : cell_data.cell_indices())
+      {
+        const auto cell =
+          cell_data.get_active_cell_iterator(i)->as_dof_handler_iterator(
+            dof_handler);
+        const FiniteElement<dim, spacedim> &fe = cell->get_fe();
+
+        local_dof_indices.resize(fe.n_dofs_per_cell());
+        cell->get_dof_indices(local_dof_indices);
+
+        for (const Point<dim> &unit_point : cell_data.get_unit_points(i))
+          for (unsigned int c = 0; c < n_vector_components; ++c)
+            {
+              for (unsigned int j = 0; j < fe.n_dofs_per_cell(); ++j)
+                {
+                  double value = 0;
+                  if (fe.is_primitive(j))
+                    {
+                      if (fe.system_to_component_index(j).first == c)
+                        value = fe.shape_value(j, unit_point);
+                    }
+                  else if (fe.get_nonzero_components(j)[c])
+                    value = fe.shape_value_component(j, unit_point, c);
+
+                  if (value != 0.)
+                    {
+                      dof_indices.push_back(local_dof_indices[j]);
+                      shape_values.push_back(value);
+                    }
+                }
+              row_starts.push_back(dof_indices.size());
+            }
+      }
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename VectorType>
+  Table<3, typename VectorType::value_type>
+  PointValueEvaluator<dim, spacedim>::evaluate(
+    const std::vector<const VectorType *> &vectors,
+    const EvaluationFlags::EvaluationFlags flags) const
+  {
+    using Number = typename VectorType::value_type;
+
+    Assert(cache != nullptr, ExcNotInitialized());
+
+    const unsigned int n_vectors = vectors.size();
+    const unsigned int n_values  = n_vectors * n_vector_components;
+
+    // compute the values of all vectors and components at the points in the
+    // locally owned cells
+    const unsigned int n_local_points =
+      (row_starts.size() - 1) / n_vector_components;
+    std::vector<Number> local_values(n_local_points * n_values);
+    for (unsigned int q = 0; q < n_local_points; ++q)
+      for (unsigned int v = 0; v < n_vectors; ++v)
+        for (unsigned int c = 0; c < n_vector_components; ++c)
+          {
+            const unsigned int row = q * n_vector_components + c;
+
+            Number sum = 0;
+            for (unsigned int k = row_starts[row]; k < row_starts[row + 1]; ++k)
+              sum += shape_values[k] *
+                     dealii::internal::ElementAccess<VectorType>::get(
+                       *vectors[v], dof_indices[k]);
+            local_values[q * n_values + v * n_vector_components + c] = sum;
+          }
+
+    // then send them to the processes that asked for the points, one value
+    // after the other, so that plain arrays of numbers are communicated,
+    // and sort the results into the output table, combining the values of
+    // points that were found in several cells
+    const std::vector<unsigned int> &point_ptrs = cache->get_point_ptrs();
+    const unsigned int               n_points   = point_ptrs.size() - 1;
+
+    Table<3, Number>    result(n_vectors, n_points, n_vector_components);
+    std::vector<Number> values_at_points;
+    std::vector<Number> buffer;
+    for (unsigned int i = 0; i < n_values; ++i)
+      {
+        cache->template evaluate_and_process<Number>(
+          values_at_points,
+          buffer,
+          [&](const ArrayView<Number> &values,
+              const typename Utilities::MPI::RemotePointEvaluation<dim,
+                                                                   spacedim>::
+                CellData &) {
+            AssertDimension(values.size(), n_local_points);
+            for (unsigned int q = 0; q < values.size(); ++q)
+              values[q] = local_values[q * n_values + i];
+          });
+
+        for (unsigned int p = 0; p < n_points; ++p)
+          {
+            const unsigned int n_entries = point_ptrs[p + 1] - point_ptrs[p];
+            if (n_entries == 0)
+              continue;
+
+            result(i / n_vector_components, p, i % n_vector_components) =
+              internal::reduce(flags,
+                               ArrayView<const Number>(values_at_points.data() +
+                                                         point_ptrs[p],
+                                                       n_entries));
+          }
+      }
+
+    return result;
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  PointValueEvaluator<dim, spacedim>::n_components() const
+  {
+    return n_vector_components;
+  }
+
 #endif
 } // namespace VectorTools
 
@@ -135,6 +135,15 @@ namespace VectorTools
    * from different processors need to be combined, see
    * VectorTools::compute_global_error().
    *
+   * @note The cells are worked on in parallel using the WorkStream
+   * framework. Consequently, the functions @p exact_solution and @p weight
+   * may be evaluated concurrently on several threads and must allow this,
+   * as is the case for all functions that do not modify any internal state
+   * when evaluated. If this is not the case, limit the number of threads to
+   * one through MultithreadInfo::set_thread_limit() (or the environment
+   * variable DEAL_II_NUM_THREADS) before calling this function; all cells
+   * are then worked on sequentially on the calling thread.
+   *
    * Instantiations for this template are provided for some vector types (see
    * the general documentation of the namespace), but only for InVectors as in
    * the documentation of the namespace, OutVector only Vector<double> and
@@ -17,6 +17,8 @@
 #define dealii_vector_tools_integrate_difference_templates_h
 
 
+#include <deal.II/base/work_stream.h>
+
 #include <deal.II/hp/fe_values.h>
 
 #include <deal.II/lac/block_vector.h>
@@ -506,42 +508,64 @@ namespace VectorTools
 
       const dealii::hp::FECollection<dim, spacedim> &fe_collection =
         dof.get_fe_collection();
-      IDScratchData<dim, spacedim, Number> data(mapping,
-                                                fe_collection,
-                                                q,
-                                                update_flags);
-
-      // loop over all cells
-      for (const auto &cell : dof.active_cell_iterators())
-        if (cell->is_locally_owned())
-          {
-            // initialize for this cell
-            data.x_fe_values.reinit(cell);
-
-            const dealii::FEValues<dim, spacedim> &fe_values =
-              data.x_fe_values.get_present_fe_values();
-            const unsigned int n_q_points = fe_values.n_quadrature_points;
-            data.resize_vectors(n_q_points, n_components);
-
-            if (update_flags & update_values)
-              fe_values.get_function_values(fe_function, data.function_values);
-            if (update_flags & update_gradients)
-              fe_values.get_function_gradients(fe_function,
-                                               data.function_grads);
-
-            difference(cell->active_cell_index()) =
-              integrate_difference_inner<dim, spacedim, Number>(exact_solution,
-                                                                norm,
-                                                                weight,
-                                                                update_flags,
-                                                                exponent,
-                                                                n_components,
-                                                                data);
-          }
-        else
-          // the cell is a ghost cell or is artificial. write a zero into the
-          // corresponding value of the returned vector
-          difference(cell->active_cell_index()) = 0;
+      const IDScratchData<dim, spacedim, Number> sample_data(mapping,
+                                                             fe_collection,
+                                                             q,
+                                                             update_flags);
+
+      // the value computed on each cell, along with the index of the cell
+      using CopyData = std::pair<unsigned int, double>;
+
+      // loop over all cells in parallel. the cells are independent of each
+      // other, so the copier only has to put the result of each cell into
+      // its slot of the output vector
+      using CellIterator =
+        typename DoFHandler<dim, spacedim>::active_cell_iterator;
+      WorkStream::run(
+        dof.begin_active(),
+        static_cast<CellIterator>(dof.end()),
+        [&](const CellIterator                   &cell,
+            IDScratchData<dim, spacedim, Number> &data,
+            CopyData                             &copy_data) {
+          copy_data.first = cell->active_cell_index();
+
+          if (cell->is_locally_owned())
+            {
+              // initialize for this cell
+              data.x_fe_values.reinit(cell);
+
+              const dealii::FEValues<dim, spacedim> &fe_values =
+                data.x_fe_values.get_present_fe_values();
+              const unsigned int n_q_points = fe_values.n_quadrature_points;
+              data.resize_vectors(n_q_points, n_components);
+
+              if (update_flags & update_values)
+                fe_values.get_function_values(fe_function,
+                                              data.function_values);
+              if (update_flags & update_gradients)
+                fe_values.get_function_gradients(fe_function,
+                                                 data.function_grads);
+
+              copy_data.second =
+                integrate_difference_inner<dim, spacedim, Number>(
+                  exact_solution,
+                  norm,
+                  weight,
+                  update_flags,
+                  exponent,
+                  n_components,
+                  data);
+            }
+          else
+            // the cell is a ghost cell or is artificial. write a zero into
+            // the corresponding value of the returned vector
+            copy_data.second = 0;
+        },
+        [&difference](const CopyData &copy_data) {
+          difference(copy_data.first) = copy_data.second;
+        },
+        sample_data,
+        CopyData());
     }
 
   } // namespace internal
@@ -0,0 +1,224 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_particles_cell_weights_h
+#define dealii_particles_cell_weights_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/smartpointer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/grid/cell_status.h>
+#include <deal.II/grid/tria.h>
+
+#include <boost/signals2/connection.hpp>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  template <int dim, int spacedim>
+  class ParticleHandler;
+
+  /**
+   * A cost model for load balancing simulations with particles. Anytime a
+   * parallel::TriangulationBase is repartitioned, this class assigns each
+   * cell the weight
+   * @f[
+   *   w_K = w_\text{cell} + w_\text{particle} \, n_K,
+   * @f]
+   * where $n_K$ is the number of particles in the cell $K$, and
+   * $w_\text{cell}$ and $w_\text{particle}$ are the cost of the work done
+   * per cell and per particle, respectively. To this end, an object of this
+   * class connects to the Triangulation::Signals::weight signal, in the same
+   * way as parallel::CellWeights does for finite element based weights. If
+   * both classes are used together, their weights are summed, and the cell
+   * weight of this class should be set to zero.
+   *
+   * The ratio of the two weights can either be prescribed, or be calibrated
+   * by calibrate() from the wall times a program measures for the work that
+   * scales with the number of cells and the work that scales with the
+   * number of particles, respectively. Since particles move, the load of
+   * the processes drifts apart over time even without mesh refinement.
+   * compute_load_imbalance() and repartition_if_imbalanced() allow to
+   * monitor this and to repartition the mesh, together with the particles,
+   * only once the imbalance exceeds a threshold:
+   * @code
+   * Particles::CellWeights<dim> cell_weights(triangulation, particle_handler);
+   * for (...)
+   *   {
+   *     timer.restart();
+   *     ... assemble and solve ...
+   *     const double time_cells = timer.wall_time();
+   *
+   *     timer.restart();
+   *     ... advect particles ...
+   *     const double time_particles = timer.wall_time();
+   *
+   *     cell_weights.calibrate(time_cells, time_particles);
+   *     cell_weights.repartition_if_imbalanced(triangulation, 1.2);
+   *   }
+   * @endcode
+   *
+   * @ingroup Particle
+   */
+  template <int dim, int spacedim = dim>
+  class CellWeights
+  {
+  public:
+    /**
+     * Constructor. Connect to the weight signal of @p triangulation, which
+     * has to be the triangulation on which @p particle_handler is built.
+     */
+    CellWeights(const Triangulation<dim, spacedim> &triangulation,
+                ParticleHandler<dim, spacedim>     &particle_handler,
+                const unsigned int                  cell_weight     = 1000,
+                const unsigned int                  particle_weight = 10);
+
+    /**
+     * Destructor. Disconnect from the weight signal.
+     */
+    ~CellWeights();
+
+    /**
+     * Set the weight of a cell and the additional weight of each particle
+     * in it.
+     */
+    void
+    set_weights(const unsigned int cell_weight,
+                const unsigned int particle_weight);
+
+    /**
+     * Return the weight of a cell.
+     */
+    unsigned int
+    get_cell_weight() const;
+
+    /**
+     * Return the additional weight of each particle.
+     */
+    unsigned int
+    get_particle_weight() const;
+
+    /**
+     * Update the particle weight from measured costs, keeping the cell
+     * weight fixed. @p time_cells is the time this process has spent on
+     * work that scales with the number of locally owned cells (e.g.,
+     * assembly), and @p time_particles the time it has spent on work that
+     * scales with the number of locally owned particles (e.g., particle
+     * advection). The times are summed over all processes, so that the
+     * particle weight is set to the cell weight times the ratio of the
+     * average cost of a particle and the average cost of a cell.
+     *
+     * The weights are left unchanged if there are no particles or no time
+     * has been spent on the cells. The cell weight needs to be positive for
+     * this function to be useful.
+     *
+     * This function is a collective operation on the communicator of the
+     * triangulation.
+     */
+    void
+    calibrate(const double time_cells, const double time_particles);
+
+    /**
+     * Return the weight of @p cell according to the current weights, given
+     * the @p status it will have after the repartitioning. This is the
+     * function connected to the weight signal of the triangulation.
+     */
+    unsigned int
+    weight(const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+           const CellStatus status) const;
+
+    /**
+     * Return the ratio between the largest load of any process and the
+     * average load over all processes, where the load of a process is the
+     * sum of the weights of its locally owned cells. A value of one
+     * indicates perfect balance.
+     *
+     * This function is a collective operation on the communicator of the
+     * triangulation.
+     */
+    double
+    compute_load_imbalance() const;
+
+    /**
+     * Repartition @p triangulation, which has to be the triangulation this
+     * object was created with, and transfer the particles to their new
+     * owners if compute_load_imbalance() exceeds @p max_imbalance. Return
+     * whether the mesh was repartitioned.
+     *
+     * This function is a collective operation on the communicator of the
+     * triangulation.
+     */
+    bool
+    repartition_if_imbalanced(
+      parallel::distributed::Triangulation<dim, spacedim> &triangulation,
+      const double                                          max_imbalance);
+
+  private:
+    /**
+     * The triangulation whose cells are weighted.
+     */
+    SmartPointer<const Triangulation<dim, spacedim>, CellWeights<dim, spacedim>>
+      triangulation;
+
+    /**
+     * The particle handler whose particles are counted.
+     */
+    SmartPointer<ParticleHandler<dim, spacedim>, CellWeights<dim, spacedim>>
+      particle_handler;
+
+    /**
+     * The weight of a cell.
+     */
+    unsigned int cell_weight;
+
+    /**
+     * The additional weight of each particle.
+     */
+    unsigned int particle_weight;
+
+    /**
+     * The connection to the weight signal of the triangulation.
+     */
+    boost::signals2::connection connection;
+  };
+
+
+
+  /* ---------------------- inline and template functions ------------------ */
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  CellWeights<dim, spacedim>::get_cell_weight() const
+  {
+    return cell_weight;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  CellWeights<dim, spacedim>::get_particle_weight() const
+  {
+    return particle_weight;
+  }
+
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
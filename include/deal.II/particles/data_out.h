@@ -78,6 +78,37 @@ namespace Particles
                     DataComponentInterpretation::DataComponentInterpretation>
                     &data_component_interpretations = {});
 
+    /**
+     * Write the particles of @p particles directly to @p out in the VTU
+     * format, without building patches first. The arguments have the same
+     * meaning as for build_patches(), and the output is the same as that of
+     * build_patches() followed by DataOutInterface::write_vtu(), using the
+     * flags set by DataOutInterface::set_flags().
+     *
+     * Building patches requires one Patch object per particle, whose memory
+     * footprint is many times larger than that of the particle data. This
+     * function instead copies the locations, ids, and properties of the
+     * particles into contiguous single precision arrays, which is the data
+     * type in which they are written anyway, and passes them to
+     * DataOutBase::write_vtu_point_cloud(). This makes it the preferred way
+     * to write large numbers of particles.
+     *
+     * Since this function sets up the same names and interpretations of the
+     * data components as build_patches(), DataOutInterface::write_pvtu_record()
+     * can be called afterwards to write the corresponding record file. Note
+     * that the other output functions of the base class still require to
+     * call build_patches() first.
+     */
+    void
+    write_vtu(const Particles::ParticleHandler<dim, spacedim> &particles,
+              std::ostream                                    &out,
+              const std::vector<std::string> &data_component_names = {},
+              const std::vector<
+                DataComponentInterpretation::DataComponentInterpretation>
+                &data_component_interpretations = {});
+
+    using DataOutInterface<0, spacedim>::write_vtu;
+
   protected:
     /**
      * Returns the patches built by the data_out class which was previously
@@ -108,6 +139,20 @@ namespace Particles
     get_nonscalar_data_ranges() const override;
 
   private:
+    /**
+     * Check the names and interpretations of the data components passed to
+     * build_patches() or write_vtu() against the particles, and store them,
+     * together with the particle id as first data component, in
+     * @p dataset_names and @p data_component_interpretations.
+     */
+    void
+    set_data_components(
+      const Particles::ParticleHandler<dim, spacedim> &particles,
+      const std::vector<std::string>                  &data_component_names,
+      const std::vector<
+        DataComponentInterpretation::DataComponentInterpretation>
+        &data_component_interpretations);
+
     /**
      * This is a vector of patches that is created each time build_patches() is
      * called. These patches are used in the output routines of the base
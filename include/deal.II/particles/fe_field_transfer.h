@@ -0,0 +1,463 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_particles_fe_field_transfer_h
+#define dealii_particles_fe_field_transfer_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/work_stream.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/mapping.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector_operation.h>
+
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  /**
+   * This class transfers data between a finite element field and the
+   * particles stored by a ParticleHandler object, as needed in
+   * particle-in-cell methods. It provides two operations:
+   *
+   * - interpolate() evaluates a finite element field with @p n_components
+   *   components at the locations of all locally owned particles, and
+   *   stores the values in @p n_components consecutive properties of each
+   *   particle. This is the operation used to move particles with a
+   *   velocity field, for example.
+   *
+   * - test_and_sum() is the transpose operation: It multiplies
+   *   @p n_components consecutive properties of each particle by the values
+   *   of the test functions at the location of the particle, and sums the
+   *   result into a vector, i.e., it computes
+   *   @f[
+   *     r_i = \sum_p \varphi_i(\mathbf x_p) \cdot \mathbf u_p,
+   *   @f]
+   *   where $\mathbf x_p$ is the location and $\mathbf u_p$ are the
+   *   properties of particle $p$. Solving a mass matrix system with this
+   *   vector as right hand side projects the particle properties onto the
+   *   finite element space.
+   *
+   * Both operations loop over the cells that contain particles and use
+   * FEPointEvaluation to evaluate the shape functions at the reference
+   * locations of all particles of a cell at once. For polynomial elements
+   * and mappings that support it, FEPointEvaluation does this with sum
+   * factorization and vectorizes over the particles. The cells are
+   * distributed over all available threads using WorkStream, which also
+   * serializes the addition of the cell contributions in test_and_sum() to
+   * the global vector.
+   *
+   * The following code computes the right hand side of an $L^2$ projection
+   * of a scalar particle property onto the finite element space and
+   * interpolates the projected field back to another property of the
+   * particles:
+   * @code
+   * Particles::FEFieldTransfer<1, dim> transfer(mapping,
+   *                                             dof_handler,
+   *                                             particle_handler);
+   * transfer.test_and_sum(0, system_rhs, constraints);
+   * ... solve the mass matrix system for projected_field ...
+   * projected_field.update_ghost_values();
+   * transfer.interpolate(projected_field, 1);
+   * @endcode
+   *
+   * @ingroup Particle
+   */
+  template <int n_components, int dim, int spacedim = dim>
+  class FEFieldTransfer
+  {
+  public:
+    /**
+     * Constructor. The finite element of @p dof_handler is evaluated with the
+     * geometry described by @p mapping at the locations of the particles in
+     * @p particle_handler, which has to be built on the same triangulation
+     * as @p dof_handler. For finite elements with more components than
+     * @p n_components, the components starting at
+     * @p first_selected_component are selected.
+     */
+    FEFieldTransfer(const Mapping<dim, spacedim>    &mapping,
+                    const DoFHandler<dim, spacedim> &dof_handler,
+                    ParticleHandler<dim, spacedim>  &particle_handler,
+                    const unsigned int first_selected_component = 0);
+
+    /**
+     * Evaluate the finite element field @p field at the locations of all
+     * locally owned particles and store the @p n_components values in the
+     * properties of the particles, starting at the property with index
+     * @p first_property_index.
+     *
+     * In parallel computations, @p field needs to provide access to the
+     * values of all degrees of freedom of the locally owned cells, i.e., it
+     * needs to have its ghost values updated. Constrained degrees of freedom
+     * are read as they are stored in @p field, so the constraints should
+     * have been distributed.
+     */
+    template <typename VectorType>
+    void
+    interpolate(const VectorType  &field,
+                const unsigned int first_property_index) const;
+
+    /**
+     * Multiply the @p n_components properties of all locally owned
+     * particles, starting at the property with index
+     * @p first_property_index, by the values of the test functions at the
+     * locations of the particles, and add the result to @p rhs, taking into
+     * account @p constraints. See the documentation of the class for the
+     * formula.
+     *
+     * This function calls <tt>rhs.compress(VectorOperation::add)</tt> at the
+     * end, and therefore is a collective operation in parallel computations.
+     */
+    template <typename VectorType>
+    void
+    test_and_sum(const unsigned int first_property_index,
+                 VectorType        &rhs,
+                 const AffineConstraints<typename VectorType::value_type>
+                   &constraints =
+                     AffineConstraints<typename VectorType::value_type>())
+      const;
+
+  private:
+    /**
+     * The evaluator and the buffers used by one thread.
+     */
+    struct ScratchData
+    {
+      ScratchData(const Mapping<dim, spacedim>       &mapping,
+                  const FiniteElement<dim, spacedim> &fe,
+                  const unsigned int                  first_selected_component);
+
+      /**
+       * Copy constructor. FEPointEvaluation objects can not be copied
+       * from a constant reference, so this creates a new evaluator.
+       */
+      ScratchData(const ScratchData &scratch);
+
+      /**
+       * The mapping passed to the constructor.
+       */
+      const Mapping<dim, spacedim> &mapping;
+
+      /**
+       * The finite element passed to the constructor.
+       */
+      const FiniteElement<dim, spacedim> &fe;
+
+      /**
+       * The first component of the finite element that is evaluated.
+       */
+      const unsigned int first_selected_component;
+
+      /**
+       * The evaluator for the particles of the current cell.
+       */
+      std::unique_ptr<FEPointEvaluation<n_components, dim, spacedim>>
+        evaluator;
+
+      /**
+       * The reference locations of the particles of the current cell.
+       */
+      std::vector<Point<dim>> reference_locations;
+
+      /**
+       * The values of the degrees of freedom of the current cell.
+       */
+      std::vector<double> dof_values;
+    };
+
+    /**
+     * The contribution of one cell in test_and_sum().
+     */
+    struct CopyData
+    {
+      std::vector<types::global_dof_index> dof_indices;
+      std::vector<double>                  values;
+    };
+
+    /**
+     * Return the locally owned cells of the DoFHandler that contain
+     * particles.
+     */
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+    get_cells_with_particles() const;
+
+    /**
+     * Set up @p scratch.evaluator for the particles in @p cell, whose
+     * handles are @p handles.
+     */
+    void
+    reinit_evaluator(
+      const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell,
+      const ArrayView<const typename PropertyPool<dim, spacedim>::Handle>
+                  &handles,
+      ScratchData &scratch) const;
+
+    /**
+     * The mapping used to evaluate the finite element.
+     */
+    SmartPointer<const Mapping<dim, spacedim>,
+                 FEFieldTransfer<n_components, dim, spacedim>>
+      mapping;
+
+    /**
+     * The DoFHandler describing the finite element fields.
+     */
+    SmartPointer<const DoFHandler<dim, spacedim>,
+                 FEFieldTransfer<n_components, dim, spacedim>>
+      dof_handler;
+
+    /**
+     * The particle handler whose particles are used.
+     */
+    SmartPointer<ParticleHandler<dim, spacedim>,
+                 FEFieldTransfer<n_components, dim, spacedim>>
+      particle_handler;
+
+    /**
+     * The first component of the finite element that is evaluated.
+     */
+    const unsigned int first_selected_component;
+  };
+
+
+
+  /* ---------------------- inline and template functions ------------------ */
+
+#ifndef DOXYGEN
+
+  template <int n_components, int dim, int spacedim>
+  FEFieldTransfer<n_components, dim, spacedim>::ScratchData::ScratchData(
+    const Mapping<dim, spacedim>       &mapping,
+    const FiniteElement<dim, spacedim> &fe,
+    const unsigned int                  first_selected_component)
+    : mapping(mapping)
+    , fe(fe)
+    , first_selected_component(first_selected_component)
+    , evaluator(
+        std::make_unique<FEPointEvaluation<n_components, dim, spacedim>>(
+          mapping,
+          fe,
+          update_values,
+          first_selected_component))
+    , dof_values(fe.n_dofs_per_cell())
+  {}
+
+
+
+  template <int n_components, int dim, int spacedim>
+  FEFieldTransfer<n_components, dim, spacedim>::ScratchData::ScratchData(
+    const ScratchData &scratch)
+    : ScratchData(scratch.mapping, scratch.fe, scratch.first_selected_component)
+  {}
+
+
+
+  template <int n_components, int dim, int spacedim>
+  FEFieldTransfer<n_components, dim, spacedim>::FEFieldTransfer(
+    const Mapping<dim, spacedim>    &mapping,
+    const DoFHandler<dim, spacedim> &dof_handler,
+    ParticleHandler<dim, spacedim>  &particle_handler,
+    const unsigned int               first_selected_component)
+    : mapping(&mapping, typeid(*this).name())
+    , dof_handler(&dof_handler, typeid(*this).name())
+    , particle_handler(&particle_handler, typeid(*this).name())
+    , first_selected_component(first_selected_component)
+  {
+    AssertIndexRange(first_selected_component + n_components,
+                     dof_handler.get_fe().n_components() + 1);
+  }
+
+
+
+  template <int n_components, int dim, int spacedim>
+  std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+  FEFieldTransfer<n_components, dim, spacedim>::get_cells_with_particles()
+    const
+  {
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+      cells;
+    for (const auto &cell : dof_handler->active_cell_iterators())
+      if (cell->is_locally_owned() &&
+          particle_handler->n_particles_in_cell(cell) > 0)
+        cells.push_back(cell);
+    return cells;
+  }
+
+
+
+  template <int n_components, int dim, int spacedim>
+  void
+  FEFieldTransfer<n_components, dim, spacedim>::reinit_evaluator(
+    const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell,
+    const ArrayView<const typename PropertyPool<dim, spacedim>::Handle>
+                &handles,
+    ScratchData &scratch) const
+  {
+    const PropertyPool<dim, spacedim> &property_pool =
+      particle_handler->get_property_pool();
+
+    scratch.reference_locations.resize(handles.size());
+    for (unsigned int i = 0; i < handles.size(); ++i)
+      scratch.reference_locations[i] =
+        property_pool.get_reference_location(handles[i]);
+
+    scratch.evaluator->reinit(cell, scratch.reference_locations);
+  }
+
+
+
+  template <int n_components, int dim, int spacedim>
+  template <typename VectorType>
+  void
+  FEFieldTransfer<n_components, dim, spacedim>::interpolate(
+    const VectorType  &field,
+    const unsigned int first_property_index) const
+  {
+    AssertDimension(field.size(), dof_handler->n_dofs());
+    AssertIndexRange(first_property_index + n_components,
+                     particle_handler->n_properties_per_particle() + 1);
+
+    const auto cells = get_cells_with_particles();
+
+    const auto worker =
+      [&](const typename std::vector<typename DoFHandler<dim, spacedim>::
+                                       active_cell_iterator>::const_iterator
+                       &cell,
+          ScratchData &scratch,
+          CopyData &) {
+        const auto handles = particle_handler->get_particle_handles(*cell);
+        reinit_evaluator(*cell, handles, scratch);
+
+        (*cell)->get_dof_values(field,
+                                scratch.dof_values.begin(),
+                                scratch.dof_values.end());
+        scratch.evaluator->evaluate(scratch.dof_values,
+                                    EvaluationFlags::values);
+
+        // Every particle is only touched by one thread, so the properties
+        // can be written directly
+        PropertyPool<dim, spacedim> &property_pool =
+          particle_handler->get_property_pool();
+        for (unsigned int i = 0; i < handles.size(); ++i)
+          {
+            const auto      &value = scratch.evaluator->get_value(i);
+            ArrayView<double> properties =
+              property_pool.get_properties(handles[i]);
+            if constexpr (n_components == 1)
+              properties[first_property_index] = value;
+            else
+              for (unsigned int c = 0; c < n_components; ++c)
+                properties[first_property_index + c] = value[c];
+          }
+      };
+
+    WorkStream::run(cells.cbegin(),
+                    cells.cend(),
+                    worker,
+                    std::function<void(const CopyData &)>(),
+                    ScratchData(*mapping,
+                                dof_handler->get_fe(),
+                                first_selected_component),
+                    CopyData());
+  }
+
+
+
+  template <int n_components, int dim, int spacedim>
+  template <typename VectorType>
+  void
+  FEFieldTransfer<n_components, dim, spacedim>::test_and_sum(
+    const unsigned int first_property_index,
+    VectorType        &rhs,
+    const AffineConstraints<typename VectorType::value_type> &constraints)
+    const
+  {
+    AssertDimension(rhs.size(), dof_handler->n_dofs());
+    AssertIndexRange(first_property_index + n_components,
+                     particle_handler->n_properties_per_particle() + 1);
+
+    const auto cells = get_cells_with_particles();
+
+    const auto worker =
+      [&](const typename std::vector<typename DoFHandler<dim, spacedim>::
+                                       active_cell_iterator>::const_iterator
+                       &cell,
+          ScratchData &scratch,
+          CopyData    &copy_data) {
+        const auto handles = particle_handler->get_particle_handles(*cell);
+        reinit_evaluator(*cell, handles, scratch);
+
+        PropertyPool<dim, spacedim> &property_pool =
+          particle_handler->get_property_pool();
+        for (unsigned int i = 0; i < handles.size(); ++i)
+          {
+            const ArrayView<double> properties =
+              property_pool.get_properties(handles[i]);
+            typename FEPointEvaluation<n_components, dim, spacedim>::
+              value_type value;
+            if constexpr (n_components == 1)
+              value = properties[first_property_index];
+            else
+              for (unsigned int c = 0; c < n_components; ++c)
+                value[c] = properties[first_property_index + c];
+            scratch.evaluator->submit_value(value, i);
+          }
+
+        copy_data.values.resize(scratch.fe.n_dofs_per_cell());
+        scratch.evaluator->test_and_sum(copy_data.values,
+                                        EvaluationFlags::values);
+
+        copy_data.dof_indices.resize(scratch.fe.n_dofs_per_cell());
+        (*cell)->get_dof_indices(copy_data.dof_indices);
+      };
+
+    // The contributions of the cells are added to the global vector one at
+    // a time, since neighboring cells share degrees of freedom
+    const auto copier = [&](const CopyData &copy_data) {
+      constraints.distribute_local_to_global(copy_data.values,
+                                             copy_data.dof_indices,
+                                             rhs);
+    };
+
+    WorkStream::run(cells.cbegin(),
+                    cells.cend(),
+                    worker,
+                    copier,
+                    ScratchData(*mapping,
+                                dof_handler->get_fe(),
+                                first_selected_component),
+                    CopyData());
+
+    rhs.compress(VectorOperation::add);
+  }
+
+#endif
+
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,310 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_particles_neighbor_list_h
+#define dealii_particles_neighbor_list_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/types.h>
+
+#include <deal.II/particles/property_pool.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  template <int dim, int spacedim>
+  class ParticleHandler;
+
+  /**
+   * A Verlet neighbor list for the particles stored by a ParticleHandler
+   * object. For each locally owned particle, the list stores all locally
+   * owned and ghost particles whose distance is at most the sum of an
+   * interaction radius and a skin distance. Codes that compute
+   * particle-particle interactions (e.g., in discrete element or smoothed
+   * particle hydrodynamics methods) can then loop over these candidates
+   * instead of over all particles in neighboring cells, and discard the
+   * candidates that are farther away than the interaction radius from their
+   * current location.
+   *
+   * The list is built with a cell-linked list: The particles are sorted
+   * into a Cartesian grid of bins whose size equals the interaction radius
+   * plus the skin, so that the neighbors of a particle can only be in the
+   * bin of the particle or in the adjacent bins. This search is done in
+   * parallel on all available threads.
+   *
+   * The particles are referred to by an index: Indices between zero and
+   * n_locally_owned_particles() denote the locally owned particles in the
+   * order in which a loop over the ParticleHandler visits them, the
+   * following n_ghost_particles() indices denote the ghost particles in the
+   * order of a loop from ParticleHandler::begin_ghost() to
+   * ParticleHandler::end_ghost(). The current locations and ids of the
+   * particles can be queried through these indices with get_locations() and
+   * get_ids().
+   *
+   * A typical time loop looks as follows:
+   * @code
+   * Particles::NeighborList<dim> neighbor_list(particle_handler,
+   *                                            interaction_radius,
+   *                                            skin);
+   * for (...)
+   *   {
+   *     // move the particles, then
+   *     particle_handler.sort_particles_into_subdomains_and_cells();
+   *     particle_handler.exchange_ghost_particles();
+   *
+   *     neighbor_list.update();
+   *     const auto &locations = neighbor_list.get_locations();
+   *     for (unsigned int i = 0;
+   *          i < neighbor_list.n_locally_owned_particles();
+   *          ++i)
+   *       for (const unsigned int j : neighbor_list.get_neighbors(i))
+   *         if (locations[i].distance(locations[j]) < interaction_radius)
+   *           ... compute the interaction between particles i and j ...
+   *   }
+   * @endcode
+   *
+   * update() only rebuilds the list if a particle has moved by more than
+   * half of the skin distance since the last rebuild, or if the set of
+   * particles or their order has changed (because particles were added,
+   * removed, or moved to other cells or processes). Otherwise it only
+   * collects the current locations of the particles, which is much cheaper
+   * than a search. A larger skin therefore reduces the number of rebuilds
+   * at the cost of more candidates per particle.
+   *
+   * @note Neighbors on other processes can only be found if they are
+   * available as ghost particles, i.e., if
+   * ParticleHandler::exchange_ghost_particles() has been called and the
+   * interaction radius plus the skin is not larger than the size of the
+   * cells at the boundary of the locally owned domain.
+   *
+   * @ingroup Particle
+   */
+  template <int dim, int spacedim = dim>
+  class NeighborList
+  {
+  public:
+    /**
+     * Constructor. Build the neighbor list for the particles currently
+     * stored in @p particle_handler. The list contains all particles closer
+     * than @p interaction_radius plus @p skin.
+     */
+    NeighborList(const ParticleHandler<dim, spacedim> &particle_handler,
+                 const double                          interaction_radius,
+                 const double                          skin);
+
+    /**
+     * Collect the current locations of the particles and rebuild the
+     * neighbor list if it may have become invalid, see the documentation of
+     * the class. Return whether the list was rebuilt.
+     */
+    bool
+    update();
+
+    /**
+     * Unconditionally rebuild the neighbor list from the current state of
+     * the particle handler.
+     */
+    void
+    rebuild();
+
+    /**
+     * Return the number of locally owned particles at the last call to
+     * update() or rebuild().
+     */
+    unsigned int
+    n_locally_owned_particles() const;
+
+    /**
+     * Return the number of ghost particles at the last call to update() or
+     * rebuild().
+     */
+    unsigned int
+    n_ghost_particles() const;
+
+    /**
+     * Return the indices of the candidate neighbors of the locally owned
+     * particle with index @p particle_index, excluding the particle itself.
+     * Indices larger or equal to n_locally_owned_particles() refer to ghost
+     * particles.
+     */
+    ArrayView<const unsigned int>
+    get_neighbors(const unsigned int particle_index) const;
+
+    /**
+     * Return the locations of the locally owned and ghost particles at the
+     * last call to update() or rebuild(), indexed as described in the
+     * documentation of the class.
+     */
+    const std::vector<Point<spacedim>> &
+    get_locations() const;
+
+    /**
+     * Return the ids of the locally owned and ghost particles, indexed as
+     * described in the documentation of the class.
+     */
+    const std::vector<types::particle_index> &
+    get_ids() const;
+
+    /**
+     * Return the number of times the neighbor list has been built so far.
+     */
+    unsigned int
+    n_rebuilds() const;
+
+  private:
+    /**
+     * Collect the locations and ids of the particles into the member
+     * variables of this class.
+     */
+    void
+    collect_particles();
+
+    /**
+     * Build the neighbor list from the locations stored in this class.
+     */
+    void
+    build_list();
+
+    /**
+     * A pointer to the particle handler whose particles are tracked.
+     */
+    SmartPointer<const ParticleHandler<dim, spacedim>,
+                 NeighborList<dim, spacedim>>
+      particle_handler;
+
+    /**
+     * The interaction radius.
+     */
+    const double interaction_radius;
+
+    /**
+     * The skin distance added to the interaction radius.
+     */
+    const double skin;
+
+    /**
+     * The number of locally owned particles.
+     */
+    unsigned int n_owned_particles;
+
+    /**
+     * The current locations of the locally owned and ghost particles.
+     */
+    std::vector<Point<spacedim>> locations;
+
+    /**
+     * The ids of the locally owned and ghost particles.
+     */
+    std::vector<types::particle_index> ids;
+
+    /**
+     * The locations of the particles when the list was last built.
+     */
+    std::vector<Point<spacedim>> locations_at_rebuild;
+
+    /**
+     * The ids of the particles when the list was last built.
+     */
+    std::vector<types::particle_index> ids_at_rebuild;
+
+    /**
+     * The neighbor list in compressed row storage: The neighbors of locally
+     * owned particle `i` are stored in the range between
+     * `neighbor_starts[i]` and `neighbor_starts[i+1]` of `neighbors`.
+     */
+    std::vector<std::size_t> neighbor_starts;
+
+    /**
+     * The indices of the neighbors, see @p neighbor_starts.
+     */
+    std::vector<unsigned int> neighbors;
+
+    /**
+     * The number of times the neighbor list has been built.
+     */
+    unsigned int rebuild_counter;
+  };
+
+
+
+  /* ---------------------- inline and template functions ------------------ */
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  NeighborList<dim, spacedim>::n_locally_owned_particles() const
+  {
+    return n_owned_particles;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  NeighborList<dim, spacedim>::n_ghost_particles() const
+  {
+    return locations.size() - n_owned_particles;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<const unsigned int>
+  NeighborList<dim, spacedim>::get_neighbors(
+    const unsigned int particle_index) const
+  {
+    AssertIndexRange(particle_index, n_owned_particles);
+    return {neighbors.data() + neighbor_starts[particle_index],
+            neighbor_starts[particle_index + 1] -
+              neighbor_starts[particle_index]};
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const std::vector<Point<spacedim>> &
+  NeighborList<dim, spacedim>::get_locations() const
+  {
+    return locations;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const std::vector<types::particle_index> &
+  NeighborList<dim, spacedim>::get_ids() const
+  {
+    return ids;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  NeighborList<dim, spacedim>::n_rebuilds() const
+  {
+    return rebuild_counter;
+  }
+
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -233,6 +233,21 @@ namespace Particles
       const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
       const;
 
+    /**
+     * Return the handles into the PropertyPool (see get_property_pool()) of
+     * the particles that live on the given cell, in the order in which
+     * particles_in_cell() traverses them. The returned view is invalidated
+     * by any operation that adds, removes, or re-sorts particles.
+     *
+     * The handles can be passed to PropertyPool::gather_property() and
+     * PropertyPool::scatter_property() to process the properties of the
+     * particles in a cell in batches of VectorizedArray<double>::size().
+     */
+    ArrayView<const typename PropertyPool<dim, spacedim>::Handle>
+    get_particle_handles(
+      const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
+      const;
+
     /**
      * Return a pair of particle iterators that mark the begin and end of
      * the particles in a particular cell. The last iterator is the first
@@ -716,6 +731,35 @@ namespace Particles
     void
     sort_particles_into_subdomains_and_cells();
 
+    /**
+     * Same as above, but only check the particles in the locally owned cells
+     * @p cells_with_moved_particles for whether they left their cell. The
+     * particles in all other cells are assumed to not have moved since the
+     * last call to one of these functions, and are neither checked nor
+     * have their reference locations updated. This makes the function
+     * cheaper if only a small fraction of the particles moved, e.g., in
+     * multi-rate time stepping schemes (see Particles::Subcycling).
+     *
+     * Like the function above, this is a collective operation that needs
+     * to be called on all processes, possibly with an empty list of cells.
+     *
+     * The function returns the locally owned cells into which particles
+     * were moved, either from other cells of this process or from other
+     * processes. A cell is listed once for every particle it received. If
+     * this list is empty and no particles left this process, the cache of
+     * the ghost particles built by exchange_ghost_particles() stays valid on
+     * this process. Since the ghost particles are updated by a collective
+     * operation, the processes need to agree on this before they call
+     * update_ghost_particles() instead of exchange_ghost_particles(), e.g.,
+     * by combining their results with Utilities::MPI::logical_or() as
+     * Particles::Subcycling::advance() does.
+     */
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+    sort_particles_into_subdomains_and_cells(
+      const std::vector<
+        typename Triangulation<dim, spacedim>::active_cell_iterator>
+        &cells_with_moved_particles);
+
     /**
      * Exchange all particles that live in cells that are ghost cells to
      * other processes. Clears and re-populates the ghost_neighbors
@@ -734,6 +778,24 @@ namespace Particles
     void
     update_ghost_particles();
 
+    /**
+     * Like the previous function, but only update the location, the
+     * reference location, and the properties with the indices given in
+     * @p property_indices of the ghost particles. This reduces the amount of
+     * data communicated in every step if only some of the properties of the
+     * ghost particles are needed and change over time.
+     *
+     * The data is exchanged through buffers and persistent MPI requests
+     * (see MPI_Send_init() and MPI_Recv_init()) that are set up at the first
+     * call of this function and reused in subsequent calls, until either
+     * the set of @p property_indices changes or the ghost particles are
+     * exchanged anew by exchange_ghost_particles(). The functions
+     * registered by register_additional_store_load_functions() are not
+     * called by this function.
+     */
+    void
+    update_ghost_particles(const std::vector<unsigned int> &property_indices);
+
     /**
      * This function prepares the particle handler for a coarsening and
      * refinement cycle, by storing the necessary information to transfer
@@ -1056,8 +1118,11 @@ namespace Particles
      * stores the necessary information to update the ghost particles.
      * Once this cache is built, the ghost particles can be updated
      * by a call to send_recv_particles_properties_and_location().
+     *
+     * @return The cells into which the received particles were inserted,
+     * one entry per particle.
      */
-    void
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
     send_recv_particles(
       const std::map<types::subdomain_id, std::vector<particle_iterator>>
         &particles_to_send,
@@ -1089,6 +1154,13 @@ namespace Particles
 
 #endif
 
+    /**
+     * Free the persistent MPI requests used by
+     * update_ghost_particles(const std::vector<unsigned int> &).
+     */
+    void
+    free_ghost_update_requests();
+
     /**
      * Cache structure used to store the elements which are required to
      * exchange the particle information (location and properties) across
@@ -17,8 +17,13 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi_stub.h>
+
 #include <deal.II/particles/particle_iterator.h>
 
+#include <map>
+#include <vector>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace Particles
@@ -110,6 +115,45 @@ namespace Particles
        * send_recv_particles_properties_and_location()
        */
       std::vector<char> recv_data;
+
+      /**
+       * Vector of size (neighbors.size()+1) with the same meaning as
+       * send_pointers, but counting particles instead of bytes.
+       */
+      std::vector<unsigned int> send_particle_pointers;
+
+      /**
+       * Vector of size (neighbors.size()+1) with the same meaning as
+       * recv_pointers, but counting particles instead of bytes.
+       */
+      std::vector<unsigned int> recv_particle_pointers;
+
+      /**
+       * The indices of the properties for which the buffers and requests
+       * of the partial update of the ghost particles below have been set up.
+       */
+      std::vector<unsigned int> partial_update_property_indices;
+
+      /**
+       * Persistent storage for the locations and selected properties of
+       * the particles to be sent to other processors in the partial update
+       * of the ghost particles.
+       */
+      std::vector<double> partial_update_send_data;
+
+      /**
+       * Persistent storage for the locations and selected properties of
+       * the ghost particles received in the partial update of the ghost
+       * particles.
+       */
+      std::vector<double> partial_update_recv_data;
+
+      /**
+       * Persistent MPI requests, created with MPI_Recv_init() and
+       * MPI_Send_init(), that exchange the data in
+       * partial_update_send_data and partial_update_recv_data.
+       */
+      std::vector<MPI_Request> partial_update_requests;
     };
   } // namespace internal
 
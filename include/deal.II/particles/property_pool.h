@@ -19,6 +19,10 @@
 
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/point.h>
+#include <deal.II/base/vectorization.h>
+
+#include <algorithm>
+#include <limits>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -205,6 +209,57 @@ namespace Particles
     ArrayView<double>
     get_properties(const Handle handle);
 
+    /**
+     * Return the property with index @p property_index of the particles
+     * identified by @p handles, with one particle per lane of the returned
+     * vectorized array (e.g., VectorizedArray<double>). At most
+     * VectorizedArrayType::size() handles can be given. The lanes beyond
+     * the given handles are filled with the property of the first particle.
+     *
+     * Together with scatter_property(), this function allows to work on the
+     * properties of several particles at once with SIMD instructions, e.g.,
+     * when updating the properties of all particles in a cell with values
+     * computed by FEPointEvaluation. Because ParticleHandler sorts the
+     * memory slots in the order in which particles are stored in cells (see
+     * sort_memory_slots()), the particles in one cell typically have
+     * consecutive handles, so that this function loads from a small,
+     * contiguous block of memory.
+     */
+    template <typename VectorizedArrayType>
+    VectorizedArrayType
+    gather_property(const ArrayView<const Handle> &handles,
+                    const unsigned int             property_index) const;
+
+    /**
+     * Write the lanes of @p values into the property with index
+     * @p property_index of the particles identified by @p handles. This is
+     * the inverse of gather_property(). Lanes beyond the number of given
+     * handles are ignored.
+     */
+    template <typename VectorizedArrayType>
+    void
+    scatter_property(const ArrayView<const Handle> &handles,
+                     const unsigned int             property_index,
+                     const VectorizedArrayType     &values);
+
+    /**
+     * Return the locations of the particles identified by @p handles, with
+     * one particle per lane. See gather_property() for the meaning of the
+     * arguments.
+     */
+    template <typename VectorizedArrayType>
+    Point<spacedim, VectorizedArrayType>
+    gather_locations(const ArrayView<const Handle> &handles) const;
+
+    /**
+     * Return the reference locations of the particles identified by
+     * @p handles, with one particle per lane. See gather_property() for the
+     * meaning of the arguments.
+     */
+    template <typename VectorizedArrayType>
+    Point<dim, VectorizedArrayType>
+    gather_reference_locations(const ArrayView<const Handle> &handles) const;
+
     /**
      * Reserve the dynamic memory needed for storing the properties of
      * @p size particles.
@@ -284,6 +339,19 @@ namespace Particles
      * to avoid memory allocation.
      */
     std::vector<Handle> currently_available_handles;
+
+    /**
+     * Compute the offsets of the data of the particles identified by
+     * @p handles, relative to the data of the particle with the smallest
+     * handle, in an array that stores @p entries_per_slot entries for each
+     * slot. Lanes beyond the given handles get the offset of the first
+     * particle. Return the smallest handle.
+     */
+    template <std::size_t n_lanes>
+    Handle
+    compute_lane_offsets(const ArrayView<const Handle> &handles,
+                         const unsigned int             entries_per_slot,
+                         unsigned int                  *offsets) const;
   };
 
 
@@ -486,6 +554,147 @@ namespace Particles
   }
 
 
+
+  template <int dim, int spacedim>
+  template <std::size_t n_lanes>
+  inline typename PropertyPool<dim, spacedim>::Handle
+  PropertyPool<dim, spacedim>::compute_lane_offsets(
+    const ArrayView<const Handle> &handles,
+    const unsigned int             entries_per_slot,
+    unsigned int                  *offsets) const
+  {
+    Assert(handles.size() > 0 && handles.size() <= n_lanes,
+           ExcMessage("The number of handles must be between one and the "
+                      "number of lanes of the vectorized array type."));
+
+    const auto [min_handle, max_handle] =
+      std::minmax_element(handles.begin(), handles.end());
+    Assert(*max_handle < locations.size(),
+           ExcMessage("Invalid handle. This can happen if the handle was "
+                      "duplicated and then one copy was deallocated before "
+                      "trying to access the properties."));
+    Assert(static_cast<std::size_t>(*max_handle - *min_handle) *
+               entries_per_slot <=
+             std::numeric_limits<unsigned int>::max(),
+           ExcMessage("The handles are too far apart for vectorized "
+                      "access."));
+    (void)max_handle;
+
+    for (unsigned int l = 0; l < n_lanes; ++l)
+      offsets[l] =
+        (handles[l < handles.size() ? l : 0] - *min_handle) * entries_per_slot;
+
+    return *min_handle;
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename VectorizedArrayType>
+  inline VectorizedArrayType
+  PropertyPool<dim, spacedim>::gather_property(
+    const ArrayView<const Handle> &handles,
+    const unsigned int             property_index) const
+  {
+    static_assert(
+      std::is_same_v<typename VectorizedArrayType::value_type, double>,
+      "Particle properties are stored as double values.");
+    AssertIndexRange(property_index, n_properties);
+
+    constexpr std::size_t n_lanes = VectorizedArrayType::size();
+    unsigned int          offsets[n_lanes];
+    const Handle          first_handle =
+      compute_lane_offsets<n_lanes>(handles, n_properties, offsets);
+
+    VectorizedArrayType result;
+    result.gather(properties.data() +
+                    static_cast<std::size_t>(first_handle) * n_properties +
+                    property_index,
+                  offsets);
+    return result;
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename VectorizedArrayType>
+  inline void
+  PropertyPool<dim, spacedim>::scatter_property(
+    const ArrayView<const Handle> &handles,
+    const unsigned int             property_index,
+    const VectorizedArrayType     &values)
+  {
+    static_assert(
+      std::is_same_v<typename VectorizedArrayType::value_type, double>,
+      "Particle properties are stored as double values.");
+    AssertIndexRange(property_index, n_properties);
+
+    constexpr std::size_t n_lanes = VectorizedArrayType::size();
+    unsigned int          offsets[n_lanes];
+    const Handle          first_handle =
+      compute_lane_offsets<n_lanes>(handles, n_properties, offsets);
+
+    double *base = properties.data() +
+                   static_cast<std::size_t>(first_handle) * n_properties +
+                   property_index;
+    if (handles.size() == n_lanes)
+      values.scatter(offsets, base);
+    else
+      for (unsigned int l = 0; l < handles.size(); ++l)
+        base[offsets[l]] = values[l];
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename VectorizedArrayType>
+  inline Point<spacedim, VectorizedArrayType>
+  PropertyPool<dim, spacedim>::gather_locations(
+    const ArrayView<const Handle> &handles) const
+  {
+    static_assert(
+      std::is_same_v<typename VectorizedArrayType::value_type, double>,
+      "Particle locations are stored as double values.");
+    static_assert(sizeof(Point<spacedim>) == spacedim * sizeof(double),
+                  "Points need to be stored without padding.");
+
+    constexpr std::size_t n_lanes = VectorizedArrayType::size();
+    unsigned int          offsets[n_lanes];
+    const Handle          first_handle =
+      compute_lane_offsets<n_lanes>(handles, spacedim, offsets);
+
+    Point<spacedim, VectorizedArrayType> result;
+    for (unsigned int d = 0; d < spacedim; ++d)
+      result[d].gather(&locations[first_handle][0] + d, offsets);
+    return result;
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename VectorizedArrayType>
+  inline Point<dim, VectorizedArrayType>
+  PropertyPool<dim, spacedim>::gather_reference_locations(
+    const ArrayView<const Handle> &handles) const
+  {
+    static_assert(
+      std::is_same_v<typename VectorizedArrayType::value_type, double>,
+      "Particle locations are stored as double values.");
+    static_assert(sizeof(Point<dim>) == dim * sizeof(double),
+                  "Points need to be stored without padding.");
+
+    constexpr std::size_t n_lanes = VectorizedArrayType::size();
+    unsigned int          offsets[n_lanes];
+    const Handle          first_handle =
+      compute_lane_offsets<n_lanes>(handles, dim, offsets);
+
+    Point<dim, VectorizedArrayType> result;
+    for (unsigned int d = 0; d < dim; ++d)
+      result[d].gather(&reference_locations[first_handle][0] + d, offsets);
+    return result;
+  }
+
+
 } // namespace Particles
 
 DEAL_II_NAMESPACE_CLOSE
@@ -0,0 +1,427 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_particles_subcycling_h
+#define dealii_particles_subcycling_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/types.h>
+
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  /**
+   * A class that implements multi-rate time stepping for the advection of
+   * particles. If the particles move with very different speeds, advancing
+   * all of them with the time step required by the fastest particles is
+   * wasteful. Instead, this class groups the particles into levels: A
+   * particle on level $k$ is advanced with the time step $\Delta t/2^k$,
+   * where $\Delta t$ is the time step of the outer time loop, and the level
+   * is chosen as the smallest one for which this time step does not exceed
+   * the stable time step of the particle (e.g., given by a CFL condition).
+   *
+   * advance() then splits the outer time step into $2^L$ substeps of size
+   * $\Delta t / 2^L$, where $L$ is the finest level that contains any
+   * particle. In each substep, it only advances the particles whose levels
+   * have a time step that starts at the beginning of the substep, i.e., the
+   * particles on level $k$ are advanced in every $2^{L-k}$-th substep. After
+   * each substep, only the cells that contain advanced particles are checked
+   * for particles that left their cell, see
+   * ParticleHandler::sort_particles_into_subdomains_and_cells(). To this
+   * end, the class keeps a list of the cells that contain particles for each
+   * level, so that a substep only visits the cells with particles on the
+   * levels it advances. Slow particles are therefore neither advanced nor
+   * located more often than necessary.
+   *
+   * The level of each particle is stored in one of its properties, whose
+   * index is passed to the constructor. This way, the level is transferred
+   * together with the particle if it moves to another process.
+   *
+   * A typical use looks as follows, with the stable time step given by the
+   * size of the cell of the particle and the velocity of the particle,
+   * which is stored in its first @p spacedim properties:
+   * @code
+   * Particles::Subcycling<dim> subcycling(triangulation,
+   *                                       particle_handler,
+   *                                       level_property_index,
+   *                                       max_level);
+   * for (...)
+   *   {
+   *     subcycling.assign_levels(
+   *       time_step,
+   *       [&](const Particles::ParticleAccessor<dim> &particle) {
+   *         Tensor<1, dim> velocity;
+   *         for (unsigned int d = 0; d < dim; ++d)
+   *           velocity[d] = particle.get_properties()[d];
+   *         const auto cell = particle.get_surrounding_cell();
+   *         return cfl * cell->minimum_vertex_distance() / velocity.norm();
+   *       });
+   *
+   *     subcycling.advance(
+   *       time_step,
+   *       [&](Particles::ParticleAccessor<dim> &particle,
+   *           const double                      time,
+   *           const double                      particle_time_step) {
+   *         ... move the particle from time t+time to
+   *             t+time+particle_time_step ...
+   *       });
+   *   }
+   * @endcode
+   *
+   * If the ghost particles are needed while the particles are advanced,
+   * e.g., to compute interactions between particles, advance() can update
+   * them after every substep, see there.
+   *
+   * @ingroup Particle
+   */
+  template <int dim, int spacedim = dim>
+  class Subcycling
+  {
+  public:
+    /**
+     * Constructor. @p particle_handler has to be built on @p triangulation.
+     * The level of every particle is stored in the property with index
+     * @p level_property_index, and the finest level is @p max_level, i.e.,
+     * an outer time step is split into at most $2^{\text{max\_level}}$
+     * substeps.
+     *
+     * All particles start on the level given by their level property,
+     * which is zero for particles whose properties have not been set. Since
+     * the constructor counts the particles on each level, it is a collective
+     * operation on the communicator of the triangulation.
+     */
+    Subcycling(const Triangulation<dim, spacedim> &triangulation,
+               ParticleHandler<dim, spacedim>     &particle_handler,
+               const unsigned int                  level_property_index,
+               const unsigned int                  max_level);
+
+    /**
+     * Assign every locally owned particle to the coarsest level whose time
+     * step, given the outer time step @p time_step, does not exceed the
+     * value that @p stable_time_step returns for the particle. Particles
+     * whose stable time step is smaller than the time step of the finest
+     * level are assigned to the finest level.
+     *
+     * @p stable_time_step is called as
+     * <tt>stable_time_step(particle)</tt> with a <tt>const
+     * ParticleAccessor<dim,spacedim> &</tt> argument.
+     *
+     * This function is a collective operation on the communicator of the
+     * triangulation.
+     */
+    template <typename StableTimeStepFunction>
+    void
+    assign_levels(const double                  time_step,
+                  const StableTimeStepFunction &stable_time_step);
+
+    /**
+     * Advance all locally owned particles over the outer time step
+     * @p time_step, calling
+     * <tt>advance_particle(particle, time, particle_time_step)</tt> for
+     * every particle at the beginning of each of its substeps. Here,
+     * @p particle is a <tt>ParticleAccessor<dim,spacedim> &</tt>, @p time
+     * is the time at the beginning of the substep relative to the beginning
+     * of the outer time step, and @p particle_time_step is the time step of
+     * the level of the particle. The function is expected to update the
+     * location (and possibly the properties) of the particle.
+     *
+     * The levels assigned by the last call to assign_levels(), and the
+     * lists of cells with particles on each level built by it, are used.
+     * advance() keeps these lists up to date when particles move to other
+     * cells, but if particles are added, removed, or sorted into cells
+     * outside of this class, assign_levels() needs to be called again
+     * before the next call to advance().
+     *
+     * If @p ghost_property_indices is given, the ghost particles are
+     * updated after every substep, so that @p advance_particle can access
+     * the current state of the ghost particles. If no particle changed its
+     * cell in the substep, this only sends the locations and the properties
+     * with the given indices through
+     * ParticleHandler::update_ghost_particles(). Otherwise, the ghost
+     * particles are exchanged anew with
+     * ParticleHandler::exchange_ghost_particles(). In the former case, the
+     * ghost particles need to have been exchanged with the cache enabled
+     * before the call to this function. If @p ghost_property_indices is not
+     * given, the ghost particles are not updated, and
+     * ParticleHandler::exchange_ghost_particles() has to be called
+     * afterwards if they are needed.
+     *
+     * This function is a collective operation on the communicator of the
+     * triangulation.
+     */
+    template <typename AdvanceParticleFunction>
+    void
+    advance(const double                   time_step,
+            const AdvanceParticleFunction &advance_particle,
+            const std::optional<std::vector<unsigned int>>
+              &ghost_property_indices = {});
+
+    /**
+     * Return the level of @p particle.
+     */
+    unsigned int
+    get_level(const ParticleAccessor<dim, spacedim> &particle) const;
+
+    /**
+     * Return the number of substeps that advance() splits an outer time
+     * step into, i.e., $2^L$, where $L$ is the finest level that contains
+     * particles on any process.
+     */
+    unsigned int
+    n_substeps() const;
+
+    /**
+     * Return the number of particles on each level, summed over all
+     * processes, as computed by the last call to assign_levels().
+     */
+    const std::vector<types::particle_index> &
+    n_particles_per_level() const;
+
+  private:
+    /**
+     * Count the particles on each level on all processes, determine the
+     * finest level that contains particles, and build the lists of the
+     * locally owned cells with particles on each level.
+     */
+    void
+    update_level_statistics();
+
+    /**
+     * Update the lists of cells with particles on the levels
+     * @p coarsest_level and finer after the particles on these levels
+     * moved. @p cells needs to contain all locally owned cells that
+     * contain particles on these levels, possibly multiple times.
+     */
+    void
+    update_cell_lists(
+      const unsigned int coarsest_level,
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+        &cells);
+
+    /**
+     * Return whether any process has particles on a level that is at least
+     * @p level.
+     */
+    bool
+    has_particles_on_or_above(const unsigned int level) const;
+
+    /**
+     * The triangulation the particles live on.
+     */
+    SmartPointer<const Triangulation<dim, spacedim>, Subcycling<dim, spacedim>>
+      triangulation;
+
+    /**
+     * The particle handler whose particles are advanced.
+     */
+    SmartPointer<ParticleHandler<dim, spacedim>, Subcycling<dim, spacedim>>
+      particle_handler;
+
+    /**
+     * The index of the property that stores the level of a particle.
+     */
+    const unsigned int level_property_index;
+
+    /**
+     * The finest level.
+     */
+    const unsigned int max_level;
+
+    /**
+     * The finest level that contains particles.
+     */
+    unsigned int finest_occupied_level;
+
+    /**
+     * The number of particles on each level, summed over all processes.
+     */
+    std::vector<types::particle_index> particles_per_level;
+
+    /**
+     * For each level, the locally owned cells that contain particles on
+     * this level.
+     */
+    std::vector<
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>>
+      cells_per_level;
+
+    /**
+     * The number of locally owned particles when the lists in
+     * cells_per_level were last updated.
+     */
+    types::particle_index n_particles_in_cell_lists;
+  };
+
+
+
+  /* ---------------------- inline and template functions ------------------ */
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  Subcycling<dim, spacedim>::get_level(
+    const ParticleAccessor<dim, spacedim> &particle) const
+  {
+    const unsigned int level = static_cast<unsigned int>(
+      particle.get_properties()[level_property_index]);
+    return std::min(level, max_level);
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  Subcycling<dim, spacedim>::n_substeps() const
+  {
+    return 1U << finest_occupied_level;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const std::vector<types::particle_index> &
+  Subcycling<dim, spacedim>::n_particles_per_level() const
+  {
+    return particles_per_level;
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename StableTimeStepFunction>
+  void
+  Subcycling<dim, spacedim>::assign_levels(
+    const double                  time_step,
+    const StableTimeStepFunction &stable_time_step)
+  {
+    Assert(time_step > 0, ExcMessage("The time step needs to be positive."));
+
+    for (auto &particle : *particle_handler)
+      {
+        const double particle_time_step = stable_time_step(
+          static_cast<const ParticleAccessor<dim, spacedim> &>(particle));
+
+        unsigned int level = 0;
+        while (level < max_level &&
+               time_step / (1U << level) > particle_time_step)
+          ++level;
+
+        particle.get_properties()[level_property_index] = level;
+      }
+
+    update_level_statistics();
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename AdvanceParticleFunction>
+  void
+  Subcycling<dim, spacedim>::advance(
+    const double                                    time_step,
+    const AdvanceParticleFunction                  &advance_particle,
+    const std::optional<std::vector<unsigned int>> &ghost_property_indices)
+  {
+    Assert(time_step > 0, ExcMessage("The time step needs to be positive."));
+    Assert(n_particles_in_cell_lists ==
+             particle_handler->n_locally_owned_particles(),
+           ExcMessage("The particles have changed since the levels were "
+                      "assigned. Call assign_levels() again before "
+                      "advance()."));
+
+    const unsigned int n_steps      = n_substeps();
+    const double       finest_step  = time_step / n_steps;
+    const unsigned int finest_level = finest_occupied_level;
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells_with_moved_particles;
+
+    for (unsigned int step = 0; step < n_steps; ++step)
+      {
+        // The particles on level k start a new time step in every
+        // 2^(finest_level-k)-th substep, so the coarsest level that is
+        // advanced in this substep is determined by the number of trailing
+        // zeros of the substep index
+        unsigned int coarsest_level = finest_level;
+        for (unsigned int s = step; coarsest_level > 0 && s % 2 == 0; s /= 2)
+          --coarsest_level;
+
+        // All processes know the global number of particles per level, so
+        // they all skip the same substeps
+        if (has_particles_on_or_above(coarsest_level) == false)
+          continue;
+
+        // Only visit the cells with particles on the levels that are
+        // advanced. A cell can contain particles on several of these levels
+        cells_with_moved_particles.clear();
+        for (unsigned int level = coarsest_level; level <= max_level; ++level)
+          cells_with_moved_particles.insert(cells_with_moved_particles.end(),
+                                            cells_per_level[level].begin(),
+                                            cells_per_level[level].end());
+        std::sort(cells_with_moved_particles.begin(),
+                  cells_with_moved_particles.end());
+        cells_with_moved_particles.erase(
+          std::unique(cells_with_moved_particles.begin(),
+                      cells_with_moved_particles.end()),
+          cells_with_moved_particles.end());
+
+        for (const auto &cell : cells_with_moved_particles)
+          for (auto &particle : particle_handler->particles_in_cell(cell))
+            {
+              const unsigned int level = get_level(particle);
+              if (level >= coarsest_level)
+                advance_particle(particle,
+                                 step * finest_step,
+                                 time_step / (1U << level));
+            }
+
+        const auto cells_with_new_particles =
+          particle_handler->sort_particles_into_subdomains_and_cells(
+            cells_with_moved_particles);
+        const bool particles_changed_cells =
+          cells_with_new_particles.size() > 0 ||
+          particle_handler->n_locally_owned_particles() !=
+            n_particles_in_cell_lists;
+
+        cells_with_moved_particles.insert(cells_with_moved_particles.end(),
+                                          cells_with_new_particles.begin(),
+                                          cells_with_new_particles.end());
+        update_cell_lists(coarsest_level, cells_with_moved_particles);
+
+        if (ghost_property_indices)
+          {
+            if (Utilities::MPI::logical_or(particles_changed_cells,
+                                           triangulation->get_communicator()))
+              particle_handler->exchange_ghost_particles(true);
+            else
+              particle_handler->update_ghost_particles(*ghost_property_indices);
+          }
+      }
+  }
+
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -5176,6 +5176,220 @@ namespace DataOutBase
   }
 
 
+  namespace
+  {
+    /**
+     * Return the XML element of a VTU file that describes the vector- or
+     * tensor-valued data set @p range, whose components are stored in the
+     * rows of @p data_vectors, with one column per node.
+     */
+    std::string
+    stringize_vtu_nonscalar_data_range(
+      const Table<2, float>          &data_vectors,
+      const std::tuple<unsigned int,
+                       unsigned int,
+                       std::string,
+                       DataComponentInterpretation::DataComponentInterpretation>
+                                     &range,
+      const std::vector<std::string> &data_names,
+      const VtkFlags                 &flags,
+      const char                     *ascii_or_binary,
+      const std::streamsize           output_precision)
+    {
+      const unsigned int n_data_sets = data_names.size();
+      const unsigned int n_nodes     = data_vectors.n_cols();
+
+      std::ostringstream o;
+
+      const auto  first_component = std::get<0>(range);
+      const auto  last_component  = std::get<1>(range);
+      const auto &name            = std::get<2>(range);
+      const bool  is_tensor =
+        (std::get<3>(range) ==
+         DataComponentInterpretation::component_is_part_of_tensor);
+      const unsigned int n_components = (is_tensor ? 9 : 3);
+      AssertThrow(last_component >= first_component,
+                  ExcLowerRange(last_component, first_component));
+      AssertThrow(last_component < n_data_sets,
+                  ExcIndexRange(last_component, 0, n_data_sets));
+      if (is_tensor)
+        {
+          AssertThrow((last_component + 1 - first_component <= 9),
+                      ExcMessage(
+                        "Can't declare a tensor with more than 9 components "
+                        "in VTK/VTU format."));
+        }
+      else
+        {
+          AssertThrow((last_component + 1 - first_component <= 3),
+                      ExcMessage(
+                        "Can't declare a vector with more than 3 components "
+                        "in VTK/VTU format."));
+        }
+
+      // write the header. concatenate all the component names with double
+      // underscores unless a vector name has been specified
+      o << "    <DataArray type=\"Float32\" Name=\"";
+
+      if (!name.empty())
+        o << name;
+      else
+        {
+          for (unsigned int i = first_component; i < last_component; ++i)
+            o << data_names[i] << "__";
+          o << data_names[last_component];
+        }
+
+      o << "\" NumberOfComponents=\"" << n_components << "\" format=\""
+        << ascii_or_binary << "\"";
+      // If present, also list the physical units for this quantity. Look
+      // this up for either the name of the whole vector/tensor, or if that
+      // isn't listed, via its first component.
+      if (!name.empty())
+        {
+          if (flags.physical_units.find(name) != flags.physical_units.end())
+            o << " units=\"" << flags.physical_units.at(name) << "\"";
+        }
+      else
+        {
+          if (flags.physical_units.find(data_names[first_component]) !=
+              flags.physical_units.end())
+            o << " units=\""
+              << flags.physical_units.at(data_names[first_component]) << "\"";
+        }
+      o << ">\n";
+
+      // now write data. pad all vectors to have three components
+      std::vector<float> data;
+      data.reserve(n_nodes * n_components);
+
+      for (unsigned int n = 0; n < n_nodes; ++n)
+        {
+          if (!is_tensor)
+            {
+              switch (last_component - first_component)
+                {
+                  case 0:
+                    data.push_back(data_vectors(first_component, n));
+                    data.push_back(0);
+                    data.push_back(0);
+                    break;
+
+                  case 1:
+                    data.push_back(data_vectors(first_component, n));
+                    data.push_back(data_vectors(first_component + 1, n));
+                    data.push_back(0);
+                    break;
+
+                  case 2:
+                    data.push_back(data_vectors(first_component, n));
+                    data.push_back(data_vectors(first_component + 1, n));
+                    data.push_back(data_vectors(first_component + 2, n));
+                    break;
+
+                  default:
+                    // Anything else is not yet implemented
+                    DEAL_II_ASSERT_UNREACHABLE();
+                }
+            }
+          else
+            {
+              Tensor<2, 3> vtk_data;
+              vtk_data = 0.;
+
+              const unsigned int size = last_component - first_component + 1;
+              if (size == 1)
+                // 1d, 1 element
+                {
+                  vtk_data[0][0] = data_vectors(first_component, n);
+                }
+              else if (size == 4)
+                // 2d, 4 elements
+                {
+                  for (unsigned int c = 0; c < size; ++c)
+                    {
+                      const auto ind =
+                        Tensor<2, 2>::unrolled_to_component_indices(c);
+                      vtk_data[ind[0]][ind[1]] =
+                        data_vectors(first_component + c, n);
+                    }
+                }
+              else if (size == 9)
+                // 3d 9 elements
+                {
+                  for (unsigned int c = 0; c < size; ++c)
+                    {
+                      const auto ind =
+                        Tensor<2, 3>::unrolled_to_component_indices(c);
+                      vtk_data[ind[0]][ind[1]] =
+                        data_vectors(first_component + c, n);
+                    }
+                }
+              else
+                {
+                  DEAL_II_ASSERT_UNREACHABLE();
+                }
+
+              // now put the tensor into data
+              // note we pad with zeros because VTK format always wants to
+              // see a 3x3 tensor, regardless of dimension
+              for (unsigned int i = 0; i < 3; ++i)
+                for (unsigned int j = 0; j < 3; ++j)
+                  data.push_back(vtk_data[i][j]);
+            }
+        } // loop over nodes
+
+      o << vtu_stringize_array(data,
+                               flags.compression_level,
+                               output_precision);
+      o << '\n';
+      o << "    </DataArray>\n";
+
+      return o.str();
+    }
+
+
+
+    /**
+     * Return the XML element of a VTU file that describes the scalar data
+     * set with index @p data_set, whose values are stored in the
+     * corresponding row of @p data_vectors.
+     */
+    std::string
+    stringize_vtu_scalar_data_set(
+      const Table<2, float>          &data_vectors,
+      const unsigned int              data_set,
+      const std::vector<std::string> &data_names,
+      const VtkFlags                 &flags,
+      const char                     *ascii_or_binary,
+      const std::streamsize           output_precision)
+    {
+      std::ostringstream o;
+
+      o << "    <DataArray type=\"Float32\" Name=\"" << data_names[data_set]
+        << "\" format=\"" << ascii_or_binary << "\"";
+      // If present, also list the physical units for this quantity.
+      if (flags.physical_units.find(data_names[data_set]) !=
+          flags.physical_units.end())
+        o << " units=\"" << flags.physical_units.at(data_names[data_set])
+          << "\"";
+
+      o << ">\n";
+
+      const std::vector<float> data(data_vectors[data_set].begin(),
+                                    data_vectors[data_set].end());
+      o << vtu_stringize_array(data,
+                               flags.compression_level,
+                               output_precision);
+      o << '\n';
+      o << "    </DataArray>\n";
+
+      return o.str();
+    }
+  } // namespace
+
+
+
   void
   write_vtu_header(std::ostream &out, const VtkFlags &flags)
   {
@@ -5245,6 +5459,179 @@ namespace DataOutBase
   }
 
 
+
+  void
+  write_vtu_point_cloud(
+    const std::vector<float>       &point_coordinates,
+    const Table<2, float>          &data_vectors,
+    const std::vector<std::string> &data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+                   &nonscalar_data_ranges,
+    const VtkFlags &flags,
+    std::ostream   &out)
+  {
+    AssertThrow(out.fail() == false, ExcIO());
+    for (const auto &unit : flags.physical_units)
+      {
+        (void)unit;
+        Assert(
+          unit.second.find('\"') == std::string::npos,
+          ExcMessage(
+            "A physical unit you provided, <" + unit.second +
+            ">, contained a quotation mark character. This is not allowed."));
+      }
+    Assert(point_coordinates.size() % 3 == 0,
+           ExcMessage("The coordinates of the points need to be given with "
+                      "three components per point."));
+
+    const unsigned int n_points = point_coordinates.size() / 3;
+
+    // Without points, write the same minimal file as for an empty set of
+    // patches
+    if (n_points == 0)
+      {
+        write_vtu(std::vector<Patch<0, 3>>(),
+                  data_names,
+                  nonscalar_data_ranges,
+                  flags,
+                  out);
+        return;
+      }
+
+    AssertDimension(data_vectors.n_rows(), data_names.size());
+    AssertDimension(data_vectors.n_cols(), n_points);
+
+    const char *ascii_or_binary =
+      (deal_ii_with_zlib &&
+       (flags.compression_level != CompressionLevel::plain_text)) ?
+        "binary" :
+        "ascii";
+    const std::streamsize output_precision = out.precision();
+
+    write_vtu_header(out, flags);
+
+    if (flags.cycle != std::numeric_limits<unsigned int>::min() ||
+        flags.time != std::numeric_limits<double>::min())
+      {
+        out << "<FieldData>\n";
+        if (flags.cycle != std::numeric_limits<unsigned int>::min())
+          out
+            << "<DataArray type=\"Float32\" Name=\"CYCLE\" NumberOfTuples=\"1\" format=\"ascii\">"
+            << flags.cycle << "</DataArray>\n";
+        if (flags.time != std::numeric_limits<double>::min())
+          out
+            << "<DataArray type=\"Float32\" Name=\"TIME\" NumberOfTuples=\"1\" format=\"ascii\">"
+            << flags.time << "</DataArray>\n";
+        out << "</FieldData>\n";
+      }
+
+    out << "<Piece NumberOfPoints=\"" << n_points << "\" NumberOfCells=\""
+        << n_points << "\" >\n";
+
+    out << "  <Points>\n";
+    out << "    <DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\""
+        << ascii_or_binary << "\">\n";
+    out << vtu_stringize_array(point_coordinates,
+                               flags.compression_level,
+                               output_precision)
+        << '\n';
+    out << "    </DataArray>\n";
+    out << "  </Points>\n\n";
+
+    // Every point forms a cell of type VTK_VERTEX. The connectivity is
+    // written in the same way as by write_vtu_main(), i.e., one cell per
+    // line in ascii format
+    {
+      std::vector<std::int32_t> offsets(n_points);
+      for (unsigned int i = 0; i < n_points; ++i)
+        offsets[i] = i + 1;
+
+      out << "  <Cells>\n";
+      out << "    <DataArray type=\"Int32\" Name=\"connectivity\" format=\""
+          << ascii_or_binary << "\">\n";
+      if (deal_ii_with_zlib &&
+          (flags.compression_level != CompressionLevel::plain_text))
+        {
+          std::vector<std::int32_t> connectivity(n_points);
+          for (unsigned int i = 0; i < n_points; ++i)
+            connectivity[i] = i;
+          out << vtu_stringize_array(connectivity,
+                                     flags.compression_level,
+                                     output_precision)
+              << '\n';
+        }
+      else
+        for (unsigned int i = 0; i < n_points; ++i)
+          out << '\t' << i << '\n';
+      out << "    </DataArray>\n";
+
+      out << "    <DataArray type=\"Int32\" Name=\"offsets\" format=\""
+          << ascii_or_binary << "\">\n";
+      out << vtu_stringize_array(offsets,
+                                 flags.compression_level,
+                                 output_precision)
+          << '\n';
+      out << "    </DataArray>\n";
+
+      // std::uint8_t might be an alias to unsigned char which is then not
+      // printed as ascii integers
+      out << "    <DataArray type=\"UInt8\" Name=\"types\" format=\""
+          << ascii_or_binary << "\">\n";
+      const unsigned int vtk_vertex = 1;
+      if (deal_ii_with_zlib &&
+          (flags.compression_level != CompressionLevel::plain_text))
+        out << vtu_stringize_array(std::vector<std::uint8_t>(n_points,
+                                                             vtk_vertex),
+                                   flags.compression_level,
+                                   output_precision);
+      else
+        out << vtu_stringize_array(std::vector<unsigned int>(n_points,
+                                                             vtk_vertex),
+                                   flags.compression_level,
+                                   output_precision);
+      out << '\n';
+      out << "    </DataArray>\n";
+      out << "  </Cells>\n";
+    }
+
+    // Then the data sets, first the vector and tensor data, then the
+    // remaining scalar data sets
+    out << "  <PointData Scalars=\"scalars\">\n";
+    std::vector<bool> data_set_handled(data_names.size(), false);
+    for (const auto &range : nonscalar_data_ranges)
+      {
+        for (unsigned int i = std::get<0>(range); i <= std::get<1>(range); ++i)
+          data_set_handled[i] = true;
+        out << stringize_vtu_nonscalar_data_range(data_vectors,
+                                                  range,
+                                                  data_names,
+                                                  flags,
+                                                  ascii_or_binary,
+                                                  output_precision);
+      }
+    for (unsigned int data_set = 0; data_set < data_names.size(); ++data_set)
+      if (data_set_handled[data_set] == false)
+        out << stringize_vtu_scalar_data_set(data_vectors,
+                                             data_set,
+                                             data_names,
+                                             flags,
+                                             ascii_or_binary,
+                                             output_precision);
+    out << "  </PointData>\n";
+    out << " </Piece>\n";
+
+    write_vtu_footer(out);
+
+    out << std::flush;
+
+    AssertThrow(out.fail() == false, ExcIO());
+  }
+
+
   template <int dim, int spacedim>
   void
   write_vtu_main(
@@ -5839,157 +6226,14 @@ namespace DataOutBase
       [&flags,
        &data_names,
        ascii_or_binary,
-       n_data_sets,
-       n_nodes,
        output_precision = out.precision()](const Table<2, float> &data_vectors,
                                            const auto            &range) {
-        std::ostringstream o;
-
-        const auto  first_component = std::get<0>(range);
-        const auto  last_component  = std::get<1>(range);
-        const auto &name            = std::get<2>(range);
-        const bool  is_tensor =
-          (std::get<3>(range) ==
-           DataComponentInterpretation::component_is_part_of_tensor);
-        const unsigned int n_components = (is_tensor ? 9 : 3);
-        AssertThrow(last_component >= first_component,
-                    ExcLowerRange(last_component, first_component));
-        AssertThrow(last_component < n_data_sets,
-                    ExcIndexRange(last_component, 0, n_data_sets));
-        if (is_tensor)
-          {
-            AssertThrow((last_component + 1 - first_component <= 9),
-                        ExcMessage(
-                          "Can't declare a tensor with more than 9 components "
-                          "in VTK/VTU format."));
-          }
-        else
-          {
-            AssertThrow((last_component + 1 - first_component <= 3),
-                        ExcMessage(
-                          "Can't declare a vector with more than 3 components "
-                          "in VTK/VTU format."));
-          }
-
-        // write the header. concatenate all the component names with double
-        // underscores unless a vector name has been specified
-        o << "    <DataArray type=\"Float32\" Name=\"";
-
-        if (!name.empty())
-          o << name;
-        else
-          {
-            for (unsigned int i = first_component; i < last_component; ++i)
-              o << data_names[i] << "__";
-            o << data_names[last_component];
-          }
-
-        o << "\" NumberOfComponents=\"" << n_components << "\" format=\""
-          << ascii_or_binary << "\"";
-        // If present, also list the physical units for this quantity. Look
-        // this up for either the name of the whole vector/tensor, or if that
-        // isn't listed, via its first component.
-        if (!name.empty())
-          {
-            if (flags.physical_units.find(name) != flags.physical_units.end())
-              o << " units=\"" << flags.physical_units.at(name) << "\"";
-          }
-        else
-          {
-            if (flags.physical_units.find(data_names[first_component]) !=
-                flags.physical_units.end())
-              o << " units=\""
-                << flags.physical_units.at(data_names[first_component]) << "\"";
-          }
-        o << ">\n";
-
-        // now write data. pad all vectors to have three components
-        std::vector<float> data;
-        data.reserve(n_nodes * n_components);
-
-        for (unsigned int n = 0; n < n_nodes; ++n)
-          {
-            if (!is_tensor)
-              {
-                switch (last_component - first_component)
-                  {
-                    case 0:
-                      data.push_back(data_vectors(first_component, n));
-                      data.push_back(0);
-                      data.push_back(0);
-                      break;
-
-                    case 1:
-                      data.push_back(data_vectors(first_component, n));
-                      data.push_back(data_vectors(first_component + 1, n));
-                      data.push_back(0);
-                      break;
-
-                    case 2:
-                      data.push_back(data_vectors(first_component, n));
-                      data.push_back(data_vectors(first_component + 1, n));
-                      data.push_back(data_vectors(first_component + 2, n));
-                      break;
-
-                    default:
-                      // Anything else is not yet implemented
-                      DEAL_II_ASSERT_UNREACHABLE();
-                  }
-              }
-            else
-              {
-                Tensor<2, 3> vtk_data;
-                vtk_data = 0.;
-
-                const unsigned int size = last_component - first_component + 1;
-                if (size == 1)
-                  // 1d, 1 element
-                  {
-                    vtk_data[0][0] = data_vectors(first_component, n);
-                  }
-                else if (size == 4)
-                  // 2d, 4 elements
-                  {
-                    for (unsigned int c = 0; c < size; ++c)
-                      {
-                        const auto ind =
-                          Tensor<2, 2>::unrolled_to_component_indices(c);
-                        vtk_data[ind[0]][ind[1]] =
-                          data_vectors(first_component + c, n);
-                      }
-                  }
-                else if (size == 9)
-                  // 3d 9 elements
-                  {
-                    for (unsigned int c = 0; c < size; ++c)
-                      {
-                        const auto ind =
-                          Tensor<2, 3>::unrolled_to_component_indices(c);
-                        vtk_data[ind[0]][ind[1]] =
-                          data_vectors(first_component + c, n);
-                      }
-                  }
-                else
-                  {
-                    DEAL_II_ASSERT_UNREACHABLE();
-                  }
-
-                // now put the tensor into data
-                // note we pad with zeros because VTK format always wants to
-                // see a 3x3 tensor, regardless of dimension
-                for (unsigned int i = 0; i < 3; ++i)
-                  for (unsigned int j = 0; j < 3; ++j)
-                    data.push_back(vtk_data[i][j]);
-              }
-          } // loop over nodes
-
-        o << vtu_stringize_array(data,
-                                 flags.compression_level,
-                                 output_precision);
-        o << '\n';
-        o << "    </DataArray>\n";
-
-        return o.str();
+        return stringize_vtu_nonscalar_data_range(data_vectors,
+                                                  range,
+                                                  data_names,
+                                                  flags,
+                                                  ascii_or_binary,
+                                                  output_precision);
       };
 
     const auto stringize_scalar_data_set =
@@ -5998,27 +6242,12 @@ namespace DataOutBase
        ascii_or_binary,
        output_precision = out.precision()](const Table<2, float> &data_vectors,
                                            const unsigned int     data_set) {
-        std::ostringstream o;
-
-        o << "    <DataArray type=\"Float32\" Name=\"" << data_names[data_set]
-          << "\" format=\"" << ascii_or_binary << "\"";
-        // If present, also list the physical units for this quantity.
-        if (flags.physical_units.find(data_names[data_set]) !=
-            flags.physical_units.end())
-          o << " units=\"" << flags.physical_units.at(data_names[data_set])
-            << "\"";
-
-        o << ">\n";
-
-        const std::vector<float> data(data_vectors[data_set].begin(),
-                                      data_vectors[data_set].end());
-        o << vtu_stringize_array(data,
-                                 flags.compression_level,
-                                 output_precision);
-        o << '\n';
-        o << "    </DataArray>\n";
-
-        return o.str();
+        return stringize_vtu_scalar_data_set(data_vectors,
+                                             data_set,
+                                             data_names,
+                                             flags,
+                                             ascii_or_binary,
+                                             output_precision);
       };
 
 
@@ -7698,6 +7927,13 @@ DataOutInterface<dim, spacedim>::write_vtu(std::ostream &out) const
                          out);
 }
 
+template <int dim, int spacedim>
+const DataOutBase::VtkFlags &
+DataOutInterface<dim, spacedim>::get_vtk_flags() const
+{
+  return vtk_flags;
+}
+
 template <int dim, int spacedim>
 void
 DataOutInterface<dim, spacedim>::write_svg(std::ostream &out) const
@@ -27,6 +27,9 @@
 #include <deal.II/grid/grid_tools_cache.h>
 #include <deal.II/grid/tria.h>
 
+#include <algorithm>
+#include <numeric>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -266,6 +269,155 @@ namespace Utilities
 
 
 
+    template <int dim, int spacedim>
+    bool
+    RemotePointEvaluation<dim, spacedim>::update_points(
+      const GridTools::Cache<dim, spacedim> &cache,
+      const std::vector<Point<spacedim>>    &points)
+    {
+#ifndef DEAL_II_WITH_MPI
+      Assert(false, ExcNeedsMPI());
+      (void)cache;
+      (void)points;
+      return false;
+#else
+      const MPI_Comm comm = cache.get_triangulation().get_communicator();
+
+      // the points can only be moved between cells if each of them has been
+      // found in exactly one cell, and if they are still the same points
+      const bool can_update =
+        ready_flag && (tria == &cache.get_triangulation()) &&
+        (mapping == &cache.get_mapping()) && unique_mapping &&
+        all_points_found_flag && (points.size() + 1 == point_ptrs.size());
+      if (Utilities::MPI::min(can_update ? 1U : 0U, comm) == 0)
+        {
+          this->reinit(cache, points);
+          return false;
+        }
+
+      // send the new locations to the processes owning the cells; they
+      // arrive in the order of the reference points in cell_data
+      std::vector<Point<spacedim>> new_locations;
+      this->process_and_evaluate<Point<spacedim>>(
+        points,
+        [&](const ArrayView<const Point<spacedim>> &values, const CellData &) {
+          new_locations.assign(values.begin(), values.end());
+        });
+
+      const unsigned int n_points = new_locations.size();
+      AssertDimension(n_points, cell_data->reference_point_values.size());
+
+      std::vector<Point<dim>>          reference_points(n_points);
+      std::vector<std::pair<int, int>> point_cells(n_points);
+
+      bool all_points_relocated = true;
+      bool some_point_moved     = false;
+      for (const unsigned int c : cell_data->cell_indices())
+        {
+          const auto cell = cell_data->get_active_cell_iterator(c);
+
+          const unsigned int begin = cell_data->reference_point_ptrs[c];
+          const unsigned int end   = cell_data->reference_point_ptrs[c + 1];
+          mapping->transform_points_real_to_unit_cell(
+            cell,
+            make_array_view(new_locations.begin() + begin,
+                            new_locations.begin() + end),
+            make_array_view(reference_points.begin() + begin,
+                            reference_points.begin() + end));
+
+          for (unsigned int i = begin; i < end; ++i)
+            {
+              point_cells[i] = cell_data->cells[c];
+
+              if (cell->reference_cell().contains_point(
+                    reference_points[i], additional_data.tolerance))
+                continue;
+
+              // the point has left its cell. look for it in the neighbors,
+              // unless the search is restricted to some vertices, in which
+              // case we leave it to the global search
+              bool found = false;
+              if (!additional_data.marked_vertices)
+                for (const unsigned int f : cell->face_indices())
+                  if (!cell->at_boundary(f) && cell->neighbor(f)->is_active() &&
+                      cell->neighbor(f)->is_locally_owned())
+                    {
+                      const auto neighbor = cell->neighbor(f);
+                      try
+                        {
+                          const Point<dim> reference_point =
+                            mapping->transform_real_to_unit_cell(
+                              neighbor, new_locations[i]);
+                          if (neighbor->reference_cell().contains_point(
+                                reference_point, additional_data.tolerance))
+                            {
+                              reference_points[i] = reference_point;
+                              point_cells[i] = {neighbor->level(),
+                                                neighbor->index()};
+                              found          = true;
+                              break;
+                            }
+                        }
+                      catch (typename Mapping<dim, spacedim>::
+                               ExcTransformationFailed &)
+                        {}
+                    }
+
+              if (found)
+                some_point_moved = true;
+              else
+                all_points_relocated = false;
+            }
+        }
+
+      if (Utilities::MPI::min(all_points_relocated ? 1U : 0U, comm) == 0)
+        {
+          this->reinit(cache, points);
+          return false;
+        }
+
+      if (!some_point_moved)
+        {
+          cell_data->reference_point_values = std::move(reference_points);
+          return true;
+        }
+
+      // some points have moved into a neighboring cell: group the points by
+      // cells again, and permute the send permutation accordingly
+      std::vector<unsigned int> order(n_points);
+      std::iota(order.begin(), order.end(), 0U);
+      std::stable_sort(order.begin(),
+                       order.end(),
+                       [&](const unsigned int a, const unsigned int b) {
+                         return point_cells[a] < point_cells[b];
+                       });
+
+      std::vector<unsigned int> new_send_permutation(n_points);
+      cell_data->cells.clear();
+      cell_data->reference_point_ptrs.clear();
+      cell_data->reference_point_values.resize(n_points);
+      for (unsigned int i = 0; i < n_points; ++i)
+        {
+          if (i == 0 || point_cells[order[i]] != point_cells[order[i - 1]])
+            {
+              cell_data->cells.emplace_back(point_cells[order[i]]);
+              cell_data->reference_point_ptrs.emplace_back(i);
+            }
+          cell_data->reference_point_values[i] = reference_points[order[i]];
+          new_send_permutation[i]              = send_permutation[order[i]];
+        }
+      cell_data->reference_point_ptrs.emplace_back(n_points);
+
+      send_permutation = std::move(new_send_permutation);
+      for (unsigned int c = 0; c < send_permutation.size(); ++c)
+        send_permutation_inv[send_permutation[c]] = c;
+
+      return true;
+#endif
+    }
+
+
+
     template <int dim, int spacedim>
     RemotePointEvaluation<dim, spacedim>::CellData::CellData(
       const Triangulation<dim, spacedim> &triangulation)
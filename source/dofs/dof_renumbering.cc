@@ -12,8 +12,11 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/template_constraints.h>
+#include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
 #include <deal.II/base/utilities.h>
 
@@ -61,6 +64,8 @@
 #include <cmath>
 #include <functional>
 #include <map>
+#include <numeric>
+#include <tuple>
 #include <vector>
 
 
@@ -661,6 +666,213 @@ namespace DoFRenumbering
 
 
 
+  template <int dim, int spacedim>
+  void
+  cell_based_Cuthill_McKee(DoFHandler<dim, spacedim> &dof_handler,
+                           const bool                 reversed_numbering)
+  {
+    std::vector<types::global_dof_index> renumbering(
+      dof_handler.n_locally_owned_dofs(), numbers::invalid_dof_index);
+    compute_cell_based_Cuthill_McKee(renumbering,
+                                     dof_handler,
+                                     reversed_numbering);
+
+    dof_handler.renumber_dofs(renumbering);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  compute_cell_based_Cuthill_McKee(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    const DoFHandler<dim, spacedim>      &dof_handler,
+    const bool                            reversed_numbering)
+  {
+    const IndexSet               &owned_dofs = dof_handler.locally_owned_dofs();
+    const types::global_dof_index n_owned_dofs = owned_dofs.n_elements();
+    AssertDimension(new_dof_indices.size(), n_owned_dofs);
+
+    if (n_owned_dofs == 0)
+      return;
+
+    // collect the DoF indices of all cells in the locally owned index space,
+    // with invalid entries for DoFs owned by other processes. the cells are
+    // independent, so fill the indices in parallel
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+      cells;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_artificial() == false)
+        cells.push_back(cell);
+
+    std::vector<std::size_t> cell_offsets(cells.size() + 1, 0);
+    for (unsigned int c = 0; c < cells.size(); ++c)
+      cell_offsets[c + 1] =
+        cell_offsets[c] + cells[c]->get_fe().n_dofs_per_cell();
+
+    std::vector<types::global_dof_index> cell_dofs(cell_offsets.back());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(cells.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<types::global_dof_index> local_dof_indices;
+        for (unsigned int c = begin; c < end; ++c)
+          {
+            local_dof_indices.resize(cell_offsets[c + 1] - cell_offsets[c]);
+            cells[c]->get_dof_indices(local_dof_indices);
+            for (unsigned int i = 0; i < local_dof_indices.size(); ++i)
+              cell_dofs[cell_offsets[c] + i] =
+                owned_dofs.index_within_set(local_dof_indices[i]);
+          }
+      },
+      /* grainsize = */ 128);
+
+    // then transpose to get the cells each locally owned DoF lives on
+    std::vector<std::size_t> dof_offsets(n_owned_dofs + 1, 0);
+    for (const types::global_dof_index i : cell_dofs)
+      if (i != numbers::invalid_dof_index)
+        ++dof_offsets[i + 1];
+    std::partial_sum(dof_offsets.begin(),
+                     dof_offsets.end(),
+                     dof_offsets.begin());
+
+    std::vector<unsigned int> dof_cells(dof_offsets.back());
+    {
+      std::vector<std::size_t> next_position(dof_offsets.begin(),
+                                             dof_offsets.end() - 1);
+      for (unsigned int c = 0; c < cells.size(); ++c)
+        for (std::size_t k = cell_offsets[c]; k < cell_offsets[c + 1]; ++k)
+          if (cell_dofs[k] != numbers::invalid_dof_index)
+            dof_cells[next_position[cell_dofs[k]]++] = c;
+    }
+
+    // approximate the coordination number of each DoF by the number of DoFs
+    // on the cells around it
+    std::vector<std::size_t> coordination(n_owned_dofs, 0);
+    parallel::apply_to_subranges(
+      types::global_dof_index(0),
+      n_owned_dofs,
+      [&](const types::global_dof_index begin,
+          const types::global_dof_index end) {
+        for (types::global_dof_index i = begin; i < end; ++i)
+          for (std::size_t k = dof_offsets[i]; k < dof_offsets[i + 1]; ++k)
+            coordination[i] +=
+              cell_offsets[dof_cells[k] + 1] - cell_offsets[dof_cells[k]];
+      },
+      /* grainsize = */ 1024);
+
+    // whether a DoF has already been assigned its new number
+    std::vector<bool> numbered(n_owned_dofs, false);
+
+    const auto find_starting_index = [&]() {
+      types::global_dof_index starting_index = numbers::invalid_dof_index;
+      for (types::global_dof_index i = 0; i < n_owned_dofs; ++i)
+        if (numbered[i] == false &&
+            (starting_index == numbers::invalid_dof_index ||
+             coordination[i] < coordination[starting_index]))
+          starting_index = i;
+      return starting_index;
+    };
+
+    // collect the as-yet unnumbered neighbors of the DoFs in the range
+    // [begin,end) of the current front. the result may contain duplicates
+    // that are removed when merging the results of all ranges
+    const auto collect_neighbors =
+      [&](const std::vector<types::global_dof_index> &front,
+          const std::size_t                           begin,
+          const std::size_t                           end,
+          std::vector<types::global_dof_index>       &neighbors) {
+        neighbors.clear();
+        for (std::size_t f = begin; f < end; ++f)
+          for (std::size_t k = dof_offsets[front[f]];
+               k < dof_offsets[front[f] + 1];
+               ++k)
+            for (std::size_t j = cell_offsets[dof_cells[k]];
+                 j < cell_offsets[dof_cells[k] + 1];
+                 ++j)
+              if (cell_dofs[j] != numbers::invalid_dof_index &&
+                  numbered[cell_dofs[j]] == false)
+                neighbors.push_back(cell_dofs[j]);
+      };
+
+    std::vector<types::global_dof_index> numbers_in_order(n_owned_dofs);
+    types::global_dof_index              next_free_number = 0;
+
+    std::vector<types::global_dof_index> front(1, find_starting_index());
+    numbered[front[0]]                   = true;
+    numbers_in_order[next_free_number++] = front[0];
+
+    std::vector<types::global_dof_index>              next_front;
+    std::vector<std::vector<types::global_dof_index>> neighbors_per_chunk;
+
+    std::vector<bool> in_next_front(n_owned_dofs, false);
+
+    std::vector<std::pair<std::size_t, types::global_dof_index>>
+      dofs_by_coordination;
+
+    while (next_free_number < n_owned_dofs)
+      {
+        // find the neighbors of the current front, on several threads if
+        // the front is large enough. the chunks are concatenated in order,
+        // so the result does not depend on the number of threads
+        const std::size_t n_chunks =
+          std::min<std::size_t>(MultithreadInfo::n_threads(),
+                                front.size() / 256 + 1);
+        neighbors_per_chunk.resize(n_chunks);
+        if (n_chunks == 1)
+          collect_neighbors(front, 0, front.size(), neighbors_per_chunk[0]);
+        else
+          {
+            Threads::TaskGroup<void> tasks;
+            for (std::size_t c = 0; c < n_chunks; ++c)
+              tasks += Threads::new_task([&, c]() {
+                collect_neighbors(front,
+                                  (c * front.size()) / n_chunks,
+                                  ((c + 1) * front.size()) / n_chunks,
+                                  neighbors_per_chunk[c]);
+              });
+            tasks.join_all();
+          }
+
+        next_front.clear();
+        for (const auto &neighbors : neighbors_per_chunk)
+          for (const types::global_dof_index i : neighbors)
+            if (in_next_front[i] == false)
+              {
+                in_next_front[i] = true;
+                next_front.push_back(i);
+              }
+
+        // if the front is empty, we have numbered a connected component of
+        // the graph completely, and start with the next one
+        if (next_front.empty())
+          next_front.push_back(find_starting_index());
+
+        // number the DoFs of the new front by increasing coordination number
+        dofs_by_coordination.clear();
+        for (const types::global_dof_index i : next_front)
+          {
+            in_next_front[i] = false;
+            dofs_by_coordination.emplace_back(coordination[i], i);
+          }
+        std::sort(dofs_by_coordination.begin(), dofs_by_coordination.end());
+
+        front.clear();
+        for (const auto &entry : dofs_by_coordination)
+          {
+            numbered[entry.second]               = true;
+            numbers_in_order[next_free_number++] = entry.second;
+            front.push_back(entry.second);
+          }
+      }
+
+    for (types::global_dof_index n = 0; n < n_owned_dofs; ++n)
+      new_dof_indices[numbers_in_order[n]] = owned_dofs.nth_index_in_set(
+        reversed_numbering ? n_owned_dofs - 1 - n : n);
+  }
+
+
+
   template <int dim, int spacedim>
   void
   component_wise(DoFHandler<dim, spacedim>       &dof_handler,
@@ -1573,6 +1785,70 @@ namespace DoFRenumbering
 
 
 
+  template <int dim, int spacedim>
+  void
+  hilbert_curve(DoFHandler<dim, spacedim> &dof_handler)
+  {
+    std::vector<types::global_dof_index> renumbering(
+      dof_handler.n_locally_owned_dofs());
+    compute_hilbert_curve(renumbering, dof_handler);
+
+    dof_handler.renumber_dofs(renumbering);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  compute_hilbert_curve(std::vector<types::global_dof_index> &new_dof_indices,
+                        const DoFHandler<dim, spacedim>      &dof_handler)
+  {
+    AssertDimension(new_dof_indices.size(), dof_handler.n_locally_owned_dofs());
+
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+      cells;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned())
+        cells.push_back(cell);
+
+    // compute the cell centers in parallel, and then their position along
+    // the Hilbert curve
+    std::vector<Point<spacedim>> centers(cells.size());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(cells.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int c = begin; c < end; ++c)
+          centers[c] = cells[c]->center();
+      },
+      /* grainsize = */ 256);
+
+    const std::vector<std::array<std::uint64_t, spacedim>> hilbert_indices =
+      Utilities::inverse_Hilbert_space_filling_curve(centers);
+
+    // sort the cells by their Hilbert index; ties (which can only happen for
+    // cells with the same center) are broken by the original order
+    std::vector<unsigned int> order(cells.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::sort(order.begin(),
+              order.end(),
+              [&](const unsigned int a, const unsigned int b) {
+                return std::tie(hilbert_indices[a], a) <
+                       std::tie(hilbert_indices[b], b);
+              });
+
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+      cell_order;
+    cell_order.reserve(cells.size());
+    for (const unsigned int c : order)
+      cell_order.push_back(cells[c]);
+
+    std::vector<types::global_dof_index> reverse(new_dof_indices.size());
+    compute_cell_wise(new_dof_indices, reverse, dof_handler, cell_order);
+  }
+
+
+
   template <int dim, int spacedim>
   void
   cell_wise(
@@ -2251,6 +2527,195 @@ namespace DoFRenumbering
 
 
 
+  template <int dim, int spacedim>
+  std::map<CellId,
+           std::pair<types::fe_index, std::vector<types::global_dof_index>>>
+  extract_cell_dof_indices(const DoFHandler<dim, spacedim> &dof_handler)
+  {
+    Assert(
+      (!dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &dof_handler.get_triangulation())),
+      ExcMessage("This function is only implemented for sequential "
+                 "triangulations."));
+
+    std::map<CellId,
+             std::pair<types::fe_index, std::vector<types::global_dof_index>>>
+      cell_dof_indices;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      {
+        std::vector<types::global_dof_index> local_dof_indices(
+          cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(local_dof_indices);
+        cell_dof_indices.emplace_hint(
+          cell_dof_indices.end(),
+          cell->id(),
+          std::make_pair(cell->active_fe_index(),
+                         std::move(local_dof_indices)));
+      }
+
+    return cell_dof_indices;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<types::global_dof_index>
+  preserve_previous_numbering(
+    DoFHandler<dim, spacedim> &dof_handler,
+    const std::map<
+      CellId,
+      std::pair<types::fe_index, std::vector<types::global_dof_index>>>
+      &previous_cell_dof_indices)
+  {
+    Assert(
+      (!dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &dof_handler.get_triangulation())),
+      ExcMessage("This function is only implemented for sequential "
+                 "triangulations."));
+
+    std::vector<types::global_dof_index> renumbering(
+      dof_handler.n_dofs(), numbers::invalid_dof_index);
+    std::vector<types::global_dof_index> previous_to_new_indices;
+    compute_preserve_previous_numbering(renumbering,
+                                        previous_to_new_indices,
+                                        dof_handler,
+                                        previous_cell_dof_indices);
+
+    dof_handler.renumber_dofs(renumbering);
+
+    return previous_to_new_indices;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  compute_preserve_previous_numbering(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    std::vector<types::global_dof_index> &previous_to_new_indices,
+    const DoFHandler<dim, spacedim>      &dof_handler,
+    const std::map<
+      CellId,
+      std::pair<types::fe_index, std::vector<types::global_dof_index>>>
+      &previous_cell_dof_indices)
+  {
+    const types::global_dof_index n_dofs = dof_handler.n_dofs();
+    AssertDimension(new_dof_indices.size(), n_dofs);
+
+    const Triangulation<dim, spacedim> &tria = dof_handler.get_triangulation();
+
+    // look up the previous DoF indices of every active cell once. a cell is
+    // unchanged if it has the same CellId and the same active FE index as
+    // before. the new DoFs on a changed cell are positioned relative to the
+    // previous DoF indices of the same cell or, if it did not exist before,
+    // of its parent
+    std::vector<const std::vector<types::global_dof_index> *> previous_dofs(
+      tria.n_active_cells(), nullptr);
+    std::vector<const std::vector<types::global_dof_index> *> anchor_dofs(
+      tria.n_active_cells(), nullptr);
+    types::global_dof_index n_previous_dofs = 0;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      {
+        const auto entry = previous_cell_dof_indices.find(cell->id());
+        if (entry != previous_cell_dof_indices.end())
+          {
+            anchor_dofs[cell->active_cell_index()] = &entry->second.second;
+            if (entry->second.first == cell->active_fe_index())
+              {
+                AssertDimension(entry->second.second.size(),
+                                cell->get_fe().n_dofs_per_cell());
+                previous_dofs[cell->active_cell_index()] =
+                  &entry->second.second;
+              }
+          }
+        else if (cell->level() > 0)
+          {
+            const auto parent =
+              previous_cell_dof_indices.find(cell->parent()->id());
+            if (parent != previous_cell_dof_indices.end())
+              anchor_dofs[cell->active_cell_index()] = &parent->second.second;
+          }
+      }
+    for (const auto &entry : previous_cell_dof_indices)
+      for (const types::global_dof_index i : entry.second.second)
+        n_previous_dofs = std::max(n_previous_dofs, i + 1);
+
+    // the new position of every DoF is determined by the key (anchor, is_new,
+    // counter): previously existing DoFs use their previous index as anchor,
+    // whereas new DoFs are placed right behind the largest previous index of
+    // their parent (or, in the absence of a parent, the last previous index we
+    // have seen in the loop over cells). rather than sorting by this key, we
+    // enumerate the DoFs in the order of (is_new, counter) and then do a
+    // stable counting sort by the anchor, which is linear in the number of
+    // DoFs
+    std::vector<types::global_dof_index> anchors(n_dofs,
+                                                 numbers::invalid_dof_index);
+    std::vector<types::global_dof_index> dof_at_previous_index(
+      n_previous_dofs, numbers::invalid_dof_index);
+    std::vector<types::global_dof_index> new_dofs;
+    std::vector<types::global_dof_index> local_dof_indices;
+
+    // first pass: degrees of freedom on unchanged cells keep their previous
+    // index as anchor. if two of them claim the same previous index, which
+    // can happen when DoF identities between different elements change, the
+    // second one is treated as a new DoF
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (const auto previous = previous_dofs[cell->active_cell_index()])
+        {
+          local_dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int i = 0; i < local_dof_indices.size(); ++i)
+            if (anchors[local_dof_indices[i]] == numbers::invalid_dof_index &&
+                dof_at_previous_index[(*previous)[i]] ==
+                  numbers::invalid_dof_index)
+              {
+                anchors[local_dof_indices[i]]         = (*previous)[i];
+                dof_at_previous_index[(*previous)[i]] = local_dof_indices[i];
+              }
+        }
+
+    // second pass: place all remaining degrees of freedom next to the
+    // previous degrees of freedom of their cell's parent
+    types::global_dof_index anchor = 0;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      {
+        const auto previous = anchor_dofs[cell->active_cell_index()];
+        if (previous != nullptr && previous->empty() == false)
+          anchor = *std::max_element(previous->begin(), previous->end());
+
+        local_dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(local_dof_indices);
+        for (const types::global_dof_index i : local_dof_indices)
+          if (anchors[i] == numbers::invalid_dof_index)
+            {
+              anchors[i] = anchor;
+              new_dofs.push_back(i);
+            }
+      }
+
+    // stable counting sort by the anchor, visiting the previously existing
+    // DoFs in the order of their index first and the new ones afterwards
+    std::vector<types::global_dof_index> offsets(n_previous_dofs + 2, 0);
+    for (types::global_dof_index i = 0; i < n_dofs; ++i)
+      ++offsets[anchors[i] + 1];
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    for (const types::global_dof_index i : dof_at_previous_index)
+      if (i != numbers::invalid_dof_index)
+        new_dof_indices[i] = offsets[anchors[i]]++;
+    for (const types::global_dof_index i : new_dofs)
+      new_dof_indices[i] = offsets[anchors[i]]++;
+
+    // finally, record where the previous degrees of freedom ended up
+    previous_to_new_indices.assign(n_previous_dofs,
+                                   numbers::invalid_dof_index);
+    for (types::global_dof_index i = 0; i < n_previous_dofs; ++i)
+      if (dof_at_previous_index[i] != numbers::invalid_dof_index)
+        previous_to_new_indices[i] =
+          new_dof_indices[dof_at_previous_index[i]];
+  }
+
+
+
   template <int dim, int spacedim>
   void
   support_point_wise(DoFHandler<dim, spacedim> &dof_handler)
@@ -635,9 +635,9 @@ MappingQ<dim, spacedim>::transform_points_real_to_unit_cell(
   const ArrayView<const Point<spacedim>>                     &real_points,
   const ArrayView<Point<dim>>                                &unit_points) const
 {
-  // Go to base class functions for dim < spacedim because it is not yet
+  // Go to base class functions for dim < spacedim - 1 because it is not yet
   // implemented with optimized code.
-  if (dim < spacedim)
+  if (dim < spacedim - 1)
     {
       Mapping<dim, spacedim>::transform_points_real_to_unit_cell(cell,
                                                                  real_points,
@@ -659,6 +659,14 @@ MappingQ<dim, spacedim>::transform_points_real_to_unit_cell(
                              support_points_higher_order.data(),
     Utilities::pow(polynomial_degree + 1, dim));
 
+  if constexpr (dim == spacedim - 1)
+    {
+      transform_points_real_to_unit_cell_codim1(support_points,
+                                                real_points,
+                                                unit_points);
+      return;
+    }
+
   // From the given (high-order) support points, now only pick the first
   // 2^dim points and construct an affine approximation from those.
   internal::MappingQImplementation::InverseQuadraticApproximation<dim, spacedim>
@@ -720,6 +728,105 @@ MappingQ<dim, spacedim>::transform_points_real_to_unit_cell(
 
 
 
+template <int dim, int spacedim>
+void
+MappingQ<dim, spacedim>::transform_points_real_to_unit_cell_codim1(
+  const ArrayView<const Point<spacedim>> &support_points,
+  const ArrayView<const Point<spacedim>> &real_points,
+  const ArrayView<Point<dim>>            &unit_points) const
+{
+  if constexpr (dim == spacedim - 1)
+    {
+      // Start the Newton iteration from the normal projection onto the least
+      // squares plane through the vertices, like
+      // transform_real_to_unit_cell() does
+      const std::vector<Point<dim>> unit_vertices(
+        unit_cell_support_points.begin(),
+        unit_cell_support_points.begin() +
+          GeometryInfo<dim>::vertices_per_cell);
+      internal::MappingQImplementation::
+        InverseQuadraticApproximation<dim, spacedim>
+          affine_approximation(
+            ArrayView<const Point<spacedim>>(
+              support_points.data(), GeometryInfo<dim>::vertices_per_cell),
+            unit_vertices);
+
+      // In 1d, the affine approximation is exact for a linear mapping
+      if (dim == 1 && polynomial_degree == 1)
+        {
+          for (unsigned int i = 0; i < real_points.size(); ++i)
+            unit_points[i] = affine_approximation.compute(real_points[i]);
+          return;
+        }
+
+      const auto transform_scalar = [&](const Point<spacedim> &p) {
+        try
+          {
+            return internal::MappingQImplementation::
+              do_transform_real_to_unit_cell_internal_codim1<dim>(
+                p,
+                affine_approximation.compute(p),
+                support_points,
+                polynomials_1d,
+                renumber_lexicographic_to_hierarchic);
+          }
+        catch (const typename Mapping<dim, spacedim>::ExcTransformationFailed &)
+          {
+            Point<dim> invalid_point;
+            invalid_point[0] = std::numeric_limits<double>::infinity();
+            return invalid_point;
+          }
+      };
+
+      const unsigned int n_points = real_points.size();
+      const unsigned int n_lanes  = VectorizedArray<double>::size();
+
+      // As for dim == spacedim, use the VectorizedArray code path if there is
+      // more than one point left to compute
+      for (unsigned int i = 0; i < n_points; i += n_lanes)
+        if (n_points - i > 1)
+          {
+            Point<spacedim, VectorizedArray<double>> p_vec;
+            for (unsigned int j = 0; j < n_lanes; ++j)
+              if (i + j < n_points)
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  p_vec[d][j] = real_points[i + j][d];
+              else
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  p_vec[d][j] = real_points[i][d];
+
+            const Point<dim, VectorizedArray<double>> unit_point =
+              internal::MappingQImplementation::
+                do_transform_real_to_unit_cell_internal_codim1<dim>(
+                  p_vec,
+                  affine_approximation.compute(p_vec),
+                  support_points,
+                  polynomials_1d,
+                  renumber_lexicographic_to_hierarchic);
+
+            // Repeat the computation with scalar arguments for the lanes
+            // that did not converge, see transform_points_real_to_unit_cell()
+            for (unsigned int j = 0; j < n_lanes && i + j < n_points; ++j)
+              if (numbers::is_finite(unit_point[0][j]))
+                for (unsigned int d = 0; d < dim; ++d)
+                  unit_points[i + j][d] = unit_point[d][j];
+              else
+                unit_points[i + j] = transform_scalar(real_points[i + j]);
+          }
+        else
+          unit_points[i] = transform_scalar(real_points[i]);
+    }
+  else
+    {
+      (void)support_points;
+      (void)real_points;
+      (void)unit_points;
+      DEAL_II_ASSERT_UNREACHABLE();
+    }
+}
+
+
+
 template <int dim, int spacedim>
 UpdateFlags
 MappingQ<dim, spacedim>::requires_update_flags(const UpdateFlags in) const
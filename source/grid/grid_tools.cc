@@ -16,6 +16,7 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/thread_management.h>
 
@@ -95,6 +96,7 @@ namespace ArborXWrappers
 #include <iostream>
 #include <limits>
 #include <list>
+#include <map>
 #include <numeric>
 #include <set>
 #include <tuple>
@@ -2002,6 +2004,66 @@ namespace GridTools
     }
   } // namespace internal
 
+  template <int dim, int spacedim>
+  void
+  partition_triangulation_hilbert(const unsigned int            n_partitions,
+                                  Triangulation<dim, spacedim> &triangulation)
+  {
+    Assert((dynamic_cast<parallel::distributed::Triangulation<dim, spacedim> *>(
+              &triangulation) == nullptr),
+           ExcMessage("Objects of type parallel::distributed::Triangulation "
+                      "are already partitioned implicitly and can not be "
+                      "partitioned again explicitly."));
+    Assert(n_partitions > 0, ExcInvalidNumberOfPartitions(n_partitions));
+    Assert(triangulation.signals.weight.empty(), ExcNotImplemented());
+
+    // signal that partitioning is going to happen
+    triangulation.signals.pre_partition();
+
+    // check for an easy return
+    if (n_partitions == 1)
+      {
+        for (const auto &cell : triangulation.active_cell_iterators())
+          cell->set_subdomain_id(0);
+        return;
+      }
+
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells;
+    cells.reserve(triangulation.n_active_cells());
+    for (const auto &cell : triangulation.active_cell_iterators())
+      cells.push_back(cell);
+
+    std::vector<Point<spacedim>> centers(cells.size());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(cells.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int c = begin; c < end; ++c)
+          centers[c] = cells[c]->center();
+      },
+      /* grainsize = */ 256);
+
+    const std::vector<std::array<std::uint64_t, spacedim>> hilbert_indices =
+      Utilities::inverse_Hilbert_space_filling_curve(centers);
+
+    std::vector<unsigned int> order(cells.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::sort(order.begin(),
+              order.end(),
+              [&](const unsigned int a, const unsigned int b) {
+                return std::tie(hilbert_indices[a], a) <
+                       std::tie(hilbert_indices[b], b);
+              });
+
+    const std::size_t n_cells = cells.size();
+    for (std::size_t i = 0; i < n_cells; ++i)
+      cells[order[i]]->set_subdomain_id(
+        static_cast<types::subdomain_id>((i * n_partitions) / n_cells));
+  }
+
+
+
   template <int dim, int spacedim>
   void
   partition_triangulation_zorder(const unsigned int            n_partitions,
@@ -3407,6 +3469,11 @@ namespace GridTools
       return found_points[id.second];
     };
 
+    // The position of each cell in cells_out, keyed by its active cell
+    // index. The points typically end up in few cells, so a map is cheaper
+    // than a table for all cells of the mesh
+    std::map<unsigned int, unsigned int> cell_to_output_index;
+
     // check if the given cell was already in the vector of cells before. If so,
     // insert in the corresponding vectors the reference point and the id.
     // Otherwise append a new entry to all vectors.
@@ -3415,13 +3482,13 @@ namespace GridTools
         const typename Triangulation<dim, spacedim>::active_cell_iterator &cell,
         const Point<dim>   &ref_point,
         const unsigned int &id) {
-        const auto it = std::find(cells_out.rbegin(), cells_out.rend(), cell);
-        if (it != cells_out.rend())
+        const auto [entry, inserted] =
+          cell_to_output_index.emplace(cell->active_cell_index(),
+                                       cells_out.size());
+        if (!inserted)
           {
-            const auto cell_id =
-              (cells_out.size() - 1 - (it - cells_out.rbegin()));
-            qpoints_out[cell_id].emplace_back(ref_point);
-            maps_out[cell_id].emplace_back(id);
+            qpoints_out[entry->second].emplace_back(ref_point);
+            maps_out[entry->second].emplace_back(id);
           }
         else
           {
@@ -4622,6 +4689,159 @@ namespace GridTools
                                          tolerance);
   }
 
+
+
+  template <int dim, int spacedim>
+  std::vector<
+    std::pair<typename Triangulation<dim, spacedim>::active_cell_iterator,
+              Point<dim>>>
+  find_active_cells_around_points(const Cache<dim, spacedim>         &cache,
+                                  const std::vector<Point<spacedim>> &points,
+                                  const double tolerance)
+  {
+    const auto &mesh    = cache.get_triangulation();
+    const auto &mapping = cache.get_mapping();
+
+    std::vector<
+      std::pair<typename Triangulation<dim, spacedim>::active_cell_iterator,
+                Point<dim>>>
+      cells_and_positions(points.size(),
+                          std::make_pair(mesh.end(), Point<dim>()));
+    if (points.empty())
+      return cells_and_positions;
+
+    // query the data structures of the cache here, so that they are built
+    // before we start the threads and so that the threads do not need to go
+    // through the mutexes of the cache for every point
+    const auto &vertex_to_cells = cache.get_vertex_to_cell_map();
+    const auto &vertex_to_cell_centers =
+      cache.get_vertex_to_cell_centers_directions();
+    const auto &used_vertices_rtree = cache.get_used_vertices_rtree();
+    const auto &cell_boxes_rtree    = cache.get_cell_bounding_boxes_rtree();
+
+    // sort the points along a Hilbert curve, packing the curve coordinates
+    // into a single integer to make the comparisons cheap (pack_integers()
+    // needs fewer than 64 bits per coordinate)
+    const int          bits_per_dim = 63 / spacedim;
+    const unsigned int n_points     = points.size();
+
+    std::vector<std::uint64_t> hilbert_indices(n_points);
+    {
+      const std::vector<std::array<std::uint64_t, spacedim>> indices =
+        Utilities::inverse_Hilbert_space_filling_curve(points, bits_per_dim);
+      parallel::apply_to_subranges(
+        0U,
+        n_points,
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
+            hilbert_indices[i] =
+              Utilities::pack_integers<spacedim>(indices[i], bits_per_dim);
+        },
+        /* grainsize = */ 1024);
+    }
+
+    std::vector<unsigned int> order(n_points);
+    std::iota(order.begin(), order.end(), 0U);
+    std::sort(order.begin(),
+              order.end(),
+              [&](const unsigned int a, const unsigned int b) {
+                return std::tie(hilbert_indices[a], a) <
+                       std::tie(hilbert_indices[b], b);
+              });
+
+    // locate the points of a contiguous range of the sorted order. first try
+    // to map a batch of upcoming points on the cell of the previous point,
+    // whose size we adapt to how successful this has been so far. only the
+    // points not within that cell are searched for individually
+    const auto locate_points = [&](const unsigned int begin,
+                                   const unsigned int end) {
+      constexpr unsigned int max_batch_size = 64;
+      unsigned int           batch_size     = 4;
+
+      std::vector<Point<spacedim>> real_points;
+      std::vector<Point<dim>>      unit_points;
+
+      typename Triangulation<dim, spacedim>::active_cell_iterator cell_hint;
+
+      unsigned int i = begin;
+      while (i < end)
+        {
+          if (cell_hint.state() == IteratorState::valid)
+            {
+              const unsigned int n = std::min(batch_size, end - i);
+              real_points.resize(n);
+              unit_points.resize(n);
+              for (unsigned int k = 0; k < n; ++k)
+                real_points[k] = points[order[i + k]];
+              mapping.transform_points_real_to_unit_cell(cell_hint,
+                                                         real_points,
+                                                         unit_points);
+
+              unsigned int n_inside = 0;
+              for (; n_inside < n; ++n_inside)
+                if (unit_points[n_inside][0] ==
+                      std::numeric_limits<double>::infinity() ||
+                    !cell_hint->reference_cell().contains_point(
+                      unit_points[n_inside], tolerance))
+                  break;
+                else
+                  cells_and_positions[order[i + n_inside]] =
+                    std::make_pair(cell_hint, unit_points[n_inside]);
+
+              i += n_inside;
+              if (n_inside == n)
+                {
+                  batch_size = std::min(2 * batch_size, max_batch_size);
+                  continue;
+                }
+              batch_size = std::max(batch_size / 2, 1U);
+            }
+
+          // find_active_cell_around_point() needs to look at all cells
+          // before it can conclude that a point is not inside the mesh. reject
+          // such points up front if they are far away from the bounding box
+          // of the closest cell. the bounding boxes are computed from the
+          // support points of the mapping and might not cover a curved cell
+          // completely, so allow for a safety margin relative to the size of
+          // the box
+          {
+            const auto closest_box = cell_boxes_rtree.qbegin(
+              boost::geometry::index::nearest(points[order[i]], 1));
+            Assert(closest_box != cell_boxes_rtree.qend(), ExcInternalError());
+            const auto &box_corners = closest_box->first.get_boundary_points();
+            if (closest_box->first.signed_distance(points[order[i]]) >
+                0.1 * box_corners.first.distance(box_corners.second))
+              {
+                ++i;
+                continue;
+              }
+          }
+
+          const auto cell_and_position =
+            find_active_cell_around_point(mapping,
+                                          mesh,
+                                          points[order[i]],
+                                          vertex_to_cells,
+                                          vertex_to_cell_centers,
+                                          cell_hint,
+                                          {},
+                                          used_vertices_rtree,
+                                          tolerance);
+          cells_and_positions[order[i]] = cell_and_position;
+          if (cell_and_position.first != mesh.end())
+            cell_hint = cell_and_position.first;
+          ++i;
+        }
+    };
+
+    parallel::apply_to_subranges(0U,
+                                 n_points,
+                                 locate_points,
+                                 /* grainsize = */ 512);
+
+    return cells_and_positions;
+  }
+
   template <int spacedim>
   std::vector<std::vector<BoundingBox<spacedim>>>
   exchange_local_bounding_boxes(
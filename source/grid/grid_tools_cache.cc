@@ -14,15 +14,46 @@
 
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
+#include <memory>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace GridTools
 {
+  namespace
+  {
+    /**
+     * Compute the bounding boxes of the cells stored in the second
+     * component of the elements of @p boxes, using several threads since
+     * this is expensive for higher order mappings.
+     */
+    template <int dim, int spacedim>
+    void
+    fill_cell_bounding_boxes(
+      const Mapping<dim, spacedim> &mapping,
+      std::vector<std::pair<
+        BoundingBox<spacedim>,
+        typename Triangulation<dim, spacedim>::active_cell_iterator>> &boxes)
+    {
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(boxes.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
+            boxes[i].first = mapping.get_bounding_box(boxes[i].second);
+        },
+        /* grainsize = */ 64);
+    }
+  } // namespace
+
+
+
   template <int dim, int spacedim>
   Cache<dim, spacedim>::Cache(const Triangulation<dim, spacedim> &tria,
                               const Mapping<dim, spacedim>       &mapping)
@@ -30,17 +61,31 @@ namespace GridTools
     , tria(&tria)
     , mapping(&mapping)
   {
-    tria_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+    // moving the vertices does not change the connectivity of the mesh, so
+    // only the data structures that depend on the geometry need to be
+    // updated in that case. every other emission of the any_change signal
+    // (including the ones by user code) requires to recompute everything.
+    // the mesh_movement signal forwards to any_change, so we connect to the
+    // former at the front to note down where the latter comes from
+    const auto vertices_moved = std::make_shared<bool>(false);
+    tria_signals.push_back(tria.signals.mesh_movement.connect(
+      [vertices_moved]() { *vertices_moved = true; },
+      boost::signals2::at_front));
+    tria_signals.push_back(
+      tria.signals.any_change.connect([this, vertices_moved]() {
+        mark_for_update(*vertices_moved ? update_geometry : update_all);
+        *vertices_moved = false;
+      }));
   }
 
   template <int dim, int spacedim>
   Cache<dim, spacedim>::~Cache()
   {
-    // Make sure that the signal that was attached to the triangulation
-    // is removed here.
-    if (tria_signal.connected())
-      tria_signal.disconnect();
+    // Make sure that the signals that were attached to the triangulation
+    // are removed here.
+    for (auto &connection : tria_signals)
+      if (connection.connected())
+        connection.disconnect();
   }
 
 
@@ -179,7 +224,8 @@ namespace GridTools
           boxes;
         boxes.reserve(tria->n_active_cells());
         for (const auto &cell : tria->active_cell_iterators())
-          boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+          boxes.emplace_back(BoundingBox<spacedim>(), cell);
+        fill_cell_bounding_boxes(*mapping, boxes);
 
         cell_bounding_boxes_rtree = pack_rtree(boxes);
 
@@ -220,7 +266,8 @@ namespace GridTools
           boxes.reserve(tria->n_active_cells());
         for (const auto &cell : tria->active_cell_iterators() |
                                   IteratorFilters::LocallyOwnedCell())
-          boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+          boxes.emplace_back(BoundingBox<spacedim>(), cell);
+        fill_cell_bounding_boxes(*mapping, boxes);
 
         locally_owned_cell_bounding_boxes_rtree = pack_rtree(boxes);
 
@@ -18,6 +18,7 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_large_count.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
@@ -3333,9 +3334,20 @@ namespace internal
                   }
             }
 
+          // the refinement choices are only needed for tetrahedra, see also
+          // reserve_space() below
+          const bool tetraheder_in_mesh =
+            (dim == 3) &&
+            std::any_of(connectivity.entity_types(dim).begin(),
+                        connectivity.entity_types(dim).end(),
+                        [](const ReferenceCell &type) {
+                          return type != ReferenceCells::Hexahedron;
+                        });
+
           // allocate memory
           reserve_space_(cells_0, n_cell);
-          reserve_space_(level, spacedim, n_cell, orientation_needed);
+          reserve_space_(
+            level, spacedim, n_cell, orientation_needed, tetraheder_in_mesh);
 
           // loop over all cells
           for (unsigned int cell = 0; cell < n_cell; ++cell)
@@ -3588,7 +3600,8 @@ namespace internal
       reserve_space_(TriaLevel         &level,
                      const unsigned int spacedim,
                      const unsigned int size,
-                     const bool         orientation_needed)
+                     const bool         orientation_needed,
+                     const bool         tetraheder_in_mesh)
       {
         const unsigned int dim = level.dim;
 
@@ -3599,7 +3612,10 @@ namespace internal
         level.level_subdomain_ids.assign(size, 0);
 
         level.refine_flags.assign(size, 0u);
-        level.refine_choice.assign(size, 0u);
+        if (tetraheder_in_mesh)
+          level.refine_choice.assign(size, 0u);
+        else
+          level.refine_choice.clear();
         level.coarsen_flags.assign(size, false);
 
         level.parents.assign((size + 1) / 2, -1);
@@ -15682,18 +15698,40 @@ template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::reset_global_cell_indices()
 {
-  {
+  const auto set_active_cell_indices = [this]() {
     types::global_cell_index cell_index = 0;
     for (const auto &cell : active_cell_iterators())
       cell->set_global_active_cell_index(cell_index++);
-  }
+  };
+
+  const auto set_level_cell_indices = [this](const unsigned int l) {
+    types::global_cell_index cell_index = 0;
+    for (const auto &cell : cell_iterators_on_level(l))
+      cell->set_global_level_cell_index(cell_index++);
+  };
+
+  // the active cell indices and the level cell indices on each level are
+  // stored in separate arrays and can therefore be computed concurrently.
+  // creating a task only pays off for many cells, though, so we deal with
+  // small meshes and the coarse levels right here
+  const unsigned int min_cells_per_task = 4096;
+
+  Threads::TaskGroup<void> tasks;
+
+  if (n_active_cells() >= min_cells_per_task)
+    tasks += Threads::new_task(set_active_cell_indices);
+  else
+    set_active_cell_indices();
 
   for (unsigned int l = 0; l < levels.size(); ++l)
-    {
-      types::global_cell_index cell_index = 0;
-      for (const auto &cell : cell_iterators_on_level(l))
-        cell->set_global_level_cell_index(cell_index++);
-    }
+    if (levels[l]->refine_flags.size() >= min_cells_per_task)
+      tasks += Threads::new_task([&set_level_cell_indices, l]() {
+        set_level_cell_indices(l);
+      });
+    else
+      set_level_cell_indices(l);
+
+  tasks.join_all();
 }
 
 
@@ -15709,64 +15747,78 @@ void Triangulation<dim, spacedim>::reset_cell_vertex_indices_cache()
       cache.clear();
       cache.resize(levels[l]->refine_flags.size() * max_vertices_per_cell,
                    numbers::invalid_unsigned_int);
-      for (const auto &cell : cell_iterators_on_level(l))
-        {
-          const unsigned int my_index = cell->index() * max_vertices_per_cell;
-
-          // to reduce the cost of this function when passing down into quads,
-          // then lines, then vertices, we use a more low-level access method
-          // for hexahedral cells, where we can streamline most of the logic
-          const ReferenceCell ref_cell = cell->reference_cell();
-          if (ref_cell == ReferenceCells::Hexahedron)
-            for (unsigned int face = 4; face < 6; ++face)
+
+      // every cell only writes into its own part of the cache, so we can
+      // work on chunks of cells in parallel
+      const auto fill_cache = [&](const unsigned int begin,
+                                  const unsigned int end) {
+        for (unsigned int c = begin; c < end; ++c)
+          {
+            const raw_cell_iterator cell(this, l, c);
+            if (cell->used() == false)
+              continue;
+
+            const unsigned int my_index = c * max_vertices_per_cell;
+
+            // to reduce the cost of this function when passing down into
+            // quads, then lines, then vertices, we use a more low-level access
+            // method for hexahedral cells, where we can streamline most of the
+            // logic
+            const ReferenceCell ref_cell = cell->reference_cell();
+            if (ref_cell == ReferenceCells::Hexahedron)
+              for (unsigned int face = 4; face < 6; ++face)
+                {
+                  const auto                face_iter = cell->face(face);
+                  const std::array<bool, 2> line_orientations{
+                    {face_iter->line_orientation(0),
+                     face_iter->line_orientation(1)}};
+                  std::array<unsigned int, 4> raw_vertex_indices{
+                    {face_iter->line(0)->vertex_index(1 - line_orientations[0]),
+                     face_iter->line(1)->vertex_index(1 - line_orientations[1]),
+                     face_iter->line(0)->vertex_index(line_orientations[0]),
+                     face_iter->line(1)->vertex_index(line_orientations[1])}};
+
+                  const unsigned char combined_orientation =
+                    levels[l]->face_orientations.get_combined_orientation(
+                      cell->index() * GeometryInfo<3>::faces_per_cell + face);
+                  std::array<unsigned int, 4> vertex_order{
+                    {ref_cell.standard_to_real_face_vertex(
+                       0, face, combined_orientation),
+                     ref_cell.standard_to_real_face_vertex(
+                       1, face, combined_orientation),
+                     ref_cell.standard_to_real_face_vertex(
+                       2, face, combined_orientation),
+                     ref_cell.standard_to_real_face_vertex(
+                       3, face, combined_orientation)}};
+
+                  const unsigned int index = my_index + 4 * (face - 4);
+                  for (unsigned int i = 0; i < 4; ++i)
+                    cache[index + i] = raw_vertex_indices[vertex_order[i]];
+                }
+            else if (ref_cell == ReferenceCells::Quadrilateral)
               {
-                const auto                face_iter = cell->face(face);
                 const std::array<bool, 2> line_orientations{
-                  {face_iter->line_orientation(0),
-                   face_iter->line_orientation(1)}};
+                  {cell->line_orientation(0), cell->line_orientation(1)}};
                 std::array<unsigned int, 4> raw_vertex_indices{
-                  {face_iter->line(0)->vertex_index(1 - line_orientations[0]),
-                   face_iter->line(1)->vertex_index(1 - line_orientations[1]),
-                   face_iter->line(0)->vertex_index(line_orientations[0]),
-                   face_iter->line(1)->vertex_index(line_orientations[1])}};
-
-                const unsigned char combined_orientation =
-                  levels[l]->face_orientations.get_combined_orientation(
-                    cell->index() * GeometryInfo<3>::faces_per_cell + face);
-                std::array<unsigned int, 4> vertex_order{
-                  {ref_cell.standard_to_real_face_vertex(0,
-                                                         face,
-                                                         combined_orientation),
-                   ref_cell.standard_to_real_face_vertex(1,
-                                                         face,
-                                                         combined_orientation),
-                   ref_cell.standard_to_real_face_vertex(2,
-                                                         face,
-                                                         combined_orientation),
-                   ref_cell.standard_to_real_face_vertex(
-                     3, face, combined_orientation)}};
-
-                const unsigned int index = my_index + 4 * (face - 4);
+                  {cell->line(0)->vertex_index(1 - line_orientations[0]),
+                   cell->line(1)->vertex_index(1 - line_orientations[1]),
+                   cell->line(0)->vertex_index(line_orientations[0]),
+                   cell->line(1)->vertex_index(line_orientations[1])}};
                 for (unsigned int i = 0; i < 4; ++i)
-                  cache[index + i] = raw_vertex_indices[vertex_order[i]];
+                  cache[my_index + i] = raw_vertex_indices[i];
               }
-          else if (ref_cell == ReferenceCells::Quadrilateral)
-            {
-              const std::array<bool, 2> line_orientations{
-                {cell->line_orientation(0), cell->line_orientation(1)}};
-              std::array<unsigned int, 4> raw_vertex_indices{
-                {cell->line(0)->vertex_index(1 - line_orientations[0]),
-                 cell->line(1)->vertex_index(1 - line_orientations[1]),
-                 cell->line(0)->vertex_index(line_orientations[0]),
-                 cell->line(1)->vertex_index(line_orientations[1])}};
-              for (unsigned int i = 0; i < 4; ++i)
-                cache[my_index + i] = raw_vertex_indices[i];
-            }
-          else
-            for (const unsigned int i : cell->vertex_indices())
-              cache[my_index + i] = internal::TriaAccessorImplementation::
-                Implementation::vertex_index(*cell, i);
-        }
+            else
+              for (const unsigned int i : cell->vertex_indices())
+                cache[my_index + i] = internal::TriaAccessorImplementation::
+                  Implementation::vertex_index(*cell, i);
+          }
+      };
+
+      parallel::apply_to_subranges(0U,
+                                   static_cast<unsigned int>(
+                                     levels[l]->refine_flags.size()),
+                                   fill_cache,
+                                   /* grainsize = */ 512);
     }
 }
 
@@ -0,0 +1,198 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/mpi.templates.h>
+
+#include <deal.II/particles/cell_weights.h>
+#include <deal.II/particles/particle_handler.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  template <int dim, int spacedim>
+  CellWeights<dim, spacedim>::CellWeights(
+    const Triangulation<dim, spacedim> &triangulation,
+    ParticleHandler<dim, spacedim>     &particle_handler,
+    const unsigned int                  cell_weight,
+    const unsigned int                  particle_weight)
+    : triangulation(&triangulation, typeid(*this).name())
+    , particle_handler(&particle_handler, typeid(*this).name())
+    , cell_weight(cell_weight)
+    , particle_weight(particle_weight)
+  {
+    connection = triangulation.signals.weight.connect(
+      [this](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+             const CellStatus status) -> unsigned int {
+        return this->weight(cell, status);
+      });
+  }
+
+
+
+  template <int dim, int spacedim>
+  CellWeights<dim, spacedim>::~CellWeights()
+  {
+    connection.disconnect();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  CellWeights<dim, spacedim>::set_weights(const unsigned int cell_weight,
+                                          const unsigned int particle_weight)
+  {
+    this->cell_weight     = cell_weight;
+    this->particle_weight = particle_weight;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  CellWeights<dim, spacedim>::calibrate(const double time_cells,
+                                        const double time_particles)
+  {
+    Assert(time_cells >= 0 && time_particles >= 0,
+           ExcMessage("The measured times must not be negative."));
+
+    const MPI_Comm mpi_communicator = triangulation->get_communicator();
+
+    unsigned int n_locally_owned_cells = 0;
+    for (const auto &cell : triangulation->active_cell_iterators())
+      if (cell->is_locally_owned())
+        ++n_locally_owned_cells;
+
+    // Sum up the times and sizes over all processes in one reduction
+    const std::array<double, 4> local_values = {
+      {time_cells,
+       time_particles,
+       static_cast<double>(n_locally_owned_cells),
+       static_cast<double>(particle_handler->n_locally_owned_particles())}};
+    std::array<double, 4> global_values;
+    Utilities::MPI::sum(local_values, mpi_communicator, global_values);
+
+    if (global_values[0] <= 0 || global_values[2] == 0 ||
+        global_values[3] == 0)
+      return;
+
+    const double cost_per_cell     = global_values[0] / global_values[2];
+    const double cost_per_particle = global_values[1] / global_values[3];
+
+    particle_weight = static_cast<unsigned int>(std::min<double>(
+      std::round(cell_weight * cost_per_particle / cost_per_cell),
+      std::numeric_limits<int>::max() / 1024));
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  CellWeights<dim, spacedim>::weight(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const CellStatus                                            status) const
+  {
+    switch (status)
+      {
+        case CellStatus::cell_will_persist:
+          return cell_weight +
+                 particle_weight * particle_handler->n_particles_in_cell(cell);
+
+        case CellStatus::cell_will_be_refined:
+        case CellStatus::cell_invalid:
+          // The function is called for each of the future children, the
+          // first one flagged as cell_will_be_refined and the remaining ones
+          // as cell_invalid, so distribute the particles of the current cell
+          // evenly among them
+          return cell_weight +
+                 particle_weight * particle_handler->n_particles_in_cell(cell) /
+                   cell->reference_cell().n_isotropic_children();
+
+        case CellStatus::children_will_be_coarsened:
+          {
+            types::particle_index n_particles = 0;
+            for (const auto &child : cell->child_iterators())
+              n_particles += particle_handler->n_particles_in_cell(child);
+            return cell_weight + particle_weight * n_particles;
+          }
+
+        default:
+          DEAL_II_ASSERT_UNREACHABLE();
+      }
+
+    return 0;
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  CellWeights<dim, spacedim>::compute_load_imbalance() const
+  {
+    double local_load = 0;
+    for (const auto &cell : triangulation->active_cell_iterators())
+      if (cell->is_locally_owned())
+        local_load += weight(cell, CellStatus::cell_will_persist);
+
+    const MPI_Comm mpi_communicator = triangulation->get_communicator();
+
+    const double max_load = Utilities::MPI::max(local_load, mpi_communicator);
+    const double average_load =
+      Utilities::MPI::sum(local_load, mpi_communicator) /
+      Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    return (average_load > 0 ? max_load / average_load : 1.);
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  CellWeights<dim, spacedim>::repartition_if_imbalanced(
+    parallel::distributed::Triangulation<dim, spacedim> &triangulation,
+    const double                                          max_imbalance)
+  {
+    Assert(&triangulation == &*this->triangulation,
+           ExcMessage("The triangulation passed to this function needs to be "
+                      "the one this object was created with."));
+    Assert(max_imbalance >= 1.,
+           ExcMessage("The imbalance is the ratio between the maximal and "
+                      "the average load and can not be less than one."));
+
+#ifdef DEAL_II_WITH_P4EST
+    if (compute_load_imbalance() <= max_imbalance)
+      return false;
+
+    particle_handler->prepare_for_coarsening_and_refinement();
+    triangulation.repartition();
+    particle_handler->unpack_after_coarsening_and_refinement();
+
+    return true;
+#else
+    (void)triangulation;
+    (void)max_imbalance;
+    DEAL_II_NOT_IMPLEMENTED();
+    return false;
+#endif
+  }
+} // namespace Particles
+
+#include "cell_weights.inst"
+
+DEAL_II_NAMESPACE_CLOSE
@@ -24,7 +24,7 @@ namespace Particles
 {
   template <int dim, int spacedim>
   void
-  DataOut<dim, spacedim>::build_patches(
+  DataOut<dim, spacedim>::set_data_components(
     const Particles::ParticleHandler<dim, spacedim> &particles,
     const std::vector<std::string>                  &data_component_names,
     const std::vector<DataComponentInterpretation::DataComponentInterpretation>
@@ -33,8 +33,8 @@ namespace Particles
     Assert(
       data_component_names.size() == data_component_interpretations_.size(),
       ExcMessage(
-        "When calling Particles::DataOut::build_patches with data component "
-        "names and interpretations you need to provide as many data component "
+        "When writing particles with data component names and "
+        "interpretations you need to provide as many data component "
         "names as interpretations. Provide the same name for components that "
         "belong to a single vector or tensor."));
 
@@ -44,16 +44,16 @@ namespace Particles
         Assert(
           particles.begin()->has_properties(),
           ExcMessage(
-            "You called Particles::DataOut::build_patches with data component "
-            "names and interpretations, but the particles do not seem to own "
-            "any properties."));
+            "You passed data component names and interpretations for the "
+            "output of particles, but the particles do not seem to own any "
+            "properties."));
 
         Assert(
           data_component_names.size() ==
             particles.begin()->get_properties().size(),
           ExcMessage(
-            "When calling Particles::DataOut::build_patches with data component "
-            "names and interpretations you need to provide as many data component "
+            "When writing particles with data component names and "
+            "interpretations you need to provide as many data component "
             "names as the particles have properties."));
       }
 
@@ -70,6 +70,21 @@ namespace Particles
       data_component_interpretations.end(),
       data_component_interpretations_.begin(),
       data_component_interpretations_.end());
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  DataOut<dim, spacedim>::build_patches(
+    const Particles::ParticleHandler<dim, spacedim> &particles,
+    const std::vector<std::string>                  &data_component_names,
+    const std::vector<DataComponentInterpretation::DataComponentInterpretation>
+      &data_component_interpretations_)
+  {
+    set_data_components(particles,
+                        data_component_names,
+                        data_component_interpretations_);
 
     const unsigned int n_property_components = data_component_names.size();
     const unsigned int n_data_components     = dataset_names.size();
@@ -101,6 +116,57 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  void
+  DataOut<dim, spacedim>::write_vtu(
+    const Particles::ParticleHandler<dim, spacedim> &particles,
+    std::ostream                                    &out,
+    const std::vector<std::string>                  &data_component_names,
+    const std::vector<DataComponentInterpretation::DataComponentInterpretation>
+      &data_component_interpretations_)
+  {
+    set_data_components(particles,
+                        data_component_names,
+                        data_component_interpretations_);
+
+    const unsigned int n_property_components = data_component_names.size();
+    const unsigned int n_particles = particles.n_locally_owned_particles();
+
+    // Copy the data into the single precision arrays that are written,
+    // with the coordinates padded to three components as required by VTK
+    std::vector<float> point_coordinates(3 * n_particles, 0.f);
+    Table<2, float>    data_vectors(dataset_names.size(), n_particles);
+
+    auto particle = particles.begin();
+    for (unsigned int i = 0; particle != particles.end(); ++particle, ++i)
+      {
+        const Point<spacedim> &location = particle->get_location();
+        for (unsigned int d = 0; d < spacedim; ++d)
+          point_coordinates[3 * i + d] = location[d];
+
+        data_vectors(0, i) = particle->get_id();
+
+        if (n_property_components > 0)
+          {
+            const ArrayView<const double> properties =
+              particle->get_properties();
+            for (unsigned int property_index = 0;
+                 property_index < n_property_components;
+                 ++property_index)
+              data_vectors(property_index + 1, i) = properties[property_index];
+          }
+      }
+
+    DataOutBase::write_vtu_point_cloud(point_coordinates,
+                                       data_vectors,
+                                       dataset_names,
+                                       get_nonscalar_data_ranges(),
+                                       this->get_vtk_flags(),
+                                       out);
+  }
+
+
+
   template <int dim, int spacedim>
   const std::vector<DataOutBase::Patch<0, spacedim>> &
   DataOut<dim, spacedim>::get_patches() const
@@ -0,0 +1,262 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/particles/neighbor_list.h>
+#include <deal.II/particles/particle_handler.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  template <int dim, int spacedim>
+  NeighborList<dim, spacedim>::NeighborList(
+    const ParticleHandler<dim, spacedim> &particle_handler,
+    const double                          interaction_radius,
+    const double                          skin)
+    : particle_handler(&particle_handler, typeid(*this).name())
+    , interaction_radius(interaction_radius)
+    , skin(skin)
+    , n_owned_particles(0)
+    , rebuild_counter(0)
+  {
+    Assert(interaction_radius > 0,
+           ExcMessage("The interaction radius needs to be positive."));
+    Assert(skin >= 0, ExcMessage("The skin distance must not be negative."));
+
+    rebuild();
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  NeighborList<dim, spacedim>::update()
+  {
+    collect_particles();
+
+    // The list remains valid as long as the particles are the same ones
+    // in the same order and no particle has moved by more than half the
+    // skin: Then no two particles can have approached each other by more
+    // than the skin since the list was built.
+    bool needs_rebuild = (ids != ids_at_rebuild);
+    if (needs_rebuild == false)
+      {
+        const double max_displacement_square = 0.25 * skin * skin;
+        for (unsigned int i = 0; i < locations.size(); ++i)
+          if (locations[i].distance_square(locations_at_rebuild[i]) >
+              max_displacement_square)
+            {
+              needs_rebuild = true;
+              break;
+            }
+      }
+
+    if (needs_rebuild)
+      build_list();
+
+    return needs_rebuild;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  NeighborList<dim, spacedim>::rebuild()
+  {
+    collect_particles();
+    build_list();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  NeighborList<dim, spacedim>::collect_particles()
+  {
+    n_owned_particles = particle_handler->n_locally_owned_particles();
+
+    locations.clear();
+    ids.clear();
+    locations.reserve(n_owned_particles);
+    ids.reserve(n_owned_particles);
+
+    for (const auto &particle : *particle_handler)
+      {
+        locations.push_back(particle.get_location());
+        ids.push_back(particle.get_id());
+      }
+    AssertDimension(locations.size(), n_owned_particles);
+
+    for (auto particle = particle_handler->begin_ghost();
+         particle != particle_handler->end_ghost();
+         ++particle)
+      {
+        locations.push_back(particle->get_location());
+        ids.push_back(particle->get_id());
+      }
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  NeighborList<dim, spacedim>::build_list()
+  {
+    ++rebuild_counter;
+    locations_at_rebuild = locations;
+    ids_at_rebuild       = ids;
+
+    neighbor_starts.assign(n_owned_particles + 1, 0);
+    neighbors.clear();
+    if (n_owned_particles == 0)
+      return;
+
+    const double search_radius        = interaction_radius + skin;
+    const double search_radius_square = search_radius * search_radius;
+
+    // Set up a Cartesian grid of bins with the size of the search radius
+    // around all particles, so that only the bin of a particle and the
+    // adjacent bins can contain its neighbors
+    Point<spacedim> lower_left  = locations[0];
+    Point<spacedim> upper_right = locations[0];
+    for (const auto &location : locations)
+      for (unsigned int d = 0; d < spacedim; ++d)
+        {
+          lower_left[d]  = std::min(lower_left[d], location[d]);
+          upper_right[d] = std::max(upper_right[d], location[d]);
+        }
+
+    std::array<std::uint64_t, spacedim> n_bins;
+    double                              n_total_bins = 1.;
+    for (unsigned int d = 0; d < spacedim; ++d)
+      {
+        n_bins[d] = static_cast<std::uint64_t>(
+                      std::floor((upper_right[d] - lower_left[d]) /
+                                 search_radius)) +
+                    1;
+        n_total_bins *= n_bins[d];
+      }
+    AssertThrow(n_total_bins < 1e18,
+                ExcMessage("The interaction radius is too small compared to "
+                           "the extent of the particle cloud."));
+    (void)n_total_bins;
+
+    const auto bin_coordinates = [&](const Point<spacedim> &location) {
+      std::array<std::uint64_t, spacedim> coordinates;
+      for (unsigned int d = 0; d < spacedim; ++d)
+        coordinates[d] = std::min<std::uint64_t>(
+          static_cast<std::uint64_t>((location[d] - lower_left[d]) /
+                                     search_radius),
+          n_bins[d] - 1);
+      return coordinates;
+    };
+
+    const auto bin_index =
+      [&](const std::array<std::uint64_t, spacedim> &coordinates) {
+        std::uint64_t index = 0;
+        for (int d = spacedim - 1; d >= 0; --d)
+          index = index * n_bins[d] + coordinates[d];
+        return index;
+      };
+
+    // Sort the particles by their bins, and record where each non-empty bin
+    // starts
+    std::vector<std::pair<std::uint64_t, unsigned int>> sorted_particles(
+      locations.size());
+    for (unsigned int i = 0; i < locations.size(); ++i)
+      sorted_particles[i] = {bin_index(bin_coordinates(locations[i])), i};
+    std::sort(sorted_particles.begin(), sorted_particles.end());
+
+    std::vector<std::uint64_t> bins;
+    std::vector<unsigned int>  bin_starts;
+    for (unsigned int i = 0; i < sorted_particles.size(); ++i)
+      if (i == 0 || sorted_particles[i].first != sorted_particles[i - 1].first)
+        {
+          bins.push_back(sorted_particles[i].first);
+          bin_starts.push_back(i);
+        }
+    bin_starts.push_back(sorted_particles.size());
+
+    // Now search the neighbors of all locally owned particles in parallel
+    std::vector<std::vector<unsigned int>> particle_neighbors(
+      n_owned_particles);
+    parallel::apply_to_subranges(
+      0U,
+      n_owned_particles,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          {
+            const auto coordinates = bin_coordinates(locations[i]);
+
+            for (unsigned int offset = 0;
+                 offset < Utilities::fixed_power<spacedim>(3U);
+                 ++offset)
+              {
+                std::array<std::uint64_t, spacedim> neighbor_coordinates;
+                bool                                inside = true;
+                for (unsigned int d = 0, o = offset; d < spacedim; ++d, o /= 3)
+                  {
+                    if ((o % 3 == 0 && coordinates[d] == 0) ||
+                        (o % 3 == 2 && coordinates[d] + 1 == n_bins[d]))
+                      inside = false;
+                    neighbor_coordinates[d] = coordinates[d] + o % 3 - 1;
+                  }
+                if (inside == false)
+                  continue;
+
+                const auto bin =
+                  std::lower_bound(bins.begin(),
+                                   bins.end(),
+                                   bin_index(neighbor_coordinates));
+                if (bin == bins.end() ||
+                    *bin != bin_index(neighbor_coordinates))
+                  continue;
+
+                const unsigned int b = bin - bins.begin();
+                for (unsigned int k = bin_starts[b]; k < bin_starts[b + 1];
+                     ++k)
+                  {
+                    const unsigned int j = sorted_particles[k].second;
+                    if (j != i && locations[i].distance_square(locations[j]) <=
+                                    search_radius_square)
+                      particle_neighbors[i].push_back(j);
+                  }
+              }
+
+            std::sort(particle_neighbors[i].begin(),
+                      particle_neighbors[i].end());
+          }
+      },
+      64);
+
+    // Finally, compress the lists
+    for (unsigned int i = 0; i < n_owned_particles; ++i)
+      neighbor_starts[i + 1] =
+        neighbor_starts[i] + particle_neighbors[i].size();
+    neighbors.reserve(neighbor_starts.back());
+    for (const auto &list : particle_neighbors)
+      neighbors.insert(neighbors.end(), list.begin(), list.end());
+  }
+} // namespace Particles
+
+#include "neighbor_list.inst"
+
+DEAL_II_NAMESPACE_CLOSE
@@ -12,6 +12,8 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
@@ -19,6 +21,7 @@
 
 #include <deal.II/particles/particle_handler.h>
 
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -104,6 +107,7 @@ namespace Particles
   template <int dim, int spacedim>
   ParticleHandler<dim, spacedim>::~ParticleHandler()
   {
+    free_ghost_update_requests();
     clear_particles();
 
     for (const auto &connection : tria_listeners)
@@ -432,6 +436,27 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  ArrayView<const typename PropertyPool<dim, spacedim>::Handle>
+  ParticleHandler<dim, spacedim>::get_particle_handles(
+    const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
+    const
+  {
+    AssertThrow(cell->is_artificial() == false,
+                ExcMessage("You can't ask for the particles on an artificial "
+                           "cell since we don't know what exists on these "
+                           "kinds of cells."));
+
+    if (cells_to_particle_cache.empty() ||
+        cells_to_particle_cache[cell->active_cell_index()] == particles.end())
+      return {};
+
+    return make_array_view(
+      cells_to_particle_cache[cell->active_cell_index()]->particles);
+  }
+
+
+
   template <int dim, int spacedim>
   typename ParticleHandler<dim, spacedim>::particle_iterator_range
   ParticleHandler<dim, spacedim>::particles_in_cell(
@@ -1207,6 +1232,31 @@ namespace Particles
   template <int dim, int spacedim>
   void
   ParticleHandler<dim, spacedim>::sort_particles_into_subdomains_and_cells()
+  {
+    Assert(triangulation != nullptr, ExcInternalError());
+
+    // Particles can be inserted into arbitrary cells, e.g. if their cell is
+    // not known. However, for artificial cells we can not evaluate
+    // the reference position of particles. Do not sort particles that are
+    // not locally owned, because they will be sorted by the process that
+    // owns them.
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells_with_particles;
+    for (const auto &cell : triangulation->active_cell_iterators())
+      if (cell->is_locally_owned() && n_particles_in_cell(cell) > 0)
+        cells_with_particles.push_back(cell);
+
+    sort_particles_into_subdomains_and_cells(cells_with_particles);
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+  ParticleHandler<dim, spacedim>::sort_particles_into_subdomains_and_cells(
+    const std::vector<
+      typename Triangulation<dim, spacedim>::active_cell_iterator>
+      &cells_with_particles)
   {
     Assert(triangulation != nullptr, ExcInternalError());
     Assert(cells_to_particle_cache.size() == triangulation->n_active_cells(),
@@ -1220,56 +1270,71 @@ namespace Particles
     // TODO: Extend this function to allow keeping particles on other
     // processes around (with an invalid cell).
 
-    std::vector<particle_iterator> particles_out_of_cell;
-
-    // Reserve some space for particles that need sorting to avoid frequent
-    // re-allocation. Guess 25% of particles need sorting. Balance memory
-    // overhead and performance.
-    particles_out_of_cell.reserve(n_locally_owned_particles() / 4);
-
-    // Now update the reference locations of the moved particles
-    std::vector<Point<spacedim>> real_locations;
-    std::vector<Point<dim>>      reference_locations;
-    real_locations.reserve(global_max_particles_per_cell);
-    reference_locations.reserve(global_max_particles_per_cell);
-
-    for (const auto &cell : triangulation->active_cell_iterators())
-      {
-        // Particles can be inserted into arbitrary cells, e.g. if their cell is
-        // not known. However, for artificial cells we can not evaluate
-        // the reference position of particles. Do not sort particles that are
-        // not locally owned, because they will be sorted by the process that
-        // owns them.
-        if (cell->is_locally_owned() == false)
+    // Update the reference locations of the particles in each cell, and
+    // collect the particles that have left their cell. The cells are
+    // independent of each other, so we can work on them in parallel. Each
+    // cell records the particles that left it separately, so that the
+    // particles end up in the same (deterministic) order as in a serial
+    // loop over the cells.
+    std::vector<std::vector<particle_iterator>> particles_out_of_cells(
+      cells_with_particles.size());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(cells_with_particles.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<Point<spacedim>> real_locations;
+        std::vector<Point<dim>>      reference_locations;
+        real_locations.reserve(global_max_particles_per_cell);
+        reference_locations.reserve(global_max_particles_per_cell);
+
+        for (unsigned int c = begin; c < end; ++c)
           {
-            continue;
-          }
+            const auto &cell = cells_with_particles[c];
+            Assert(cell->is_locally_owned(),
+                   ExcMessage("Only the particles in locally owned cells "
+                              "can be sorted."));
 
-        const unsigned int n_pic = n_particles_in_cell(cell);
-        auto               pic   = particles_in_cell(cell);
+            const unsigned int n_pic = n_particles_in_cell(cell);
+            if (n_pic == 0)
+              continue;
+            auto               pic   = particles_in_cell(cell);
 
-        real_locations.clear();
-        for (const auto &particle : pic)
-          real_locations.push_back(particle.get_location());
+            real_locations.clear();
+            for (const auto &particle : pic)
+              real_locations.push_back(particle.get_location());
 
-        reference_locations.resize(n_pic);
-        mapping->transform_points_real_to_unit_cell(cell,
-                                                    real_locations,
-                                                    reference_locations);
+            reference_locations.resize(n_pic);
+            mapping->transform_points_real_to_unit_cell(cell,
+                                                        real_locations,
+                                                        reference_locations);
 
-        auto particle = pic.begin();
-        for (const auto &p_unit : reference_locations)
-          {
-            if (numbers::is_finite(p_unit[0]) &&
-                GeometryInfo<dim>::is_inside_unit_cell(p_unit,
-                                                       tolerance_inside_cell))
-              particle->set_reference_location(p_unit);
-            else
-              particles_out_of_cell.push_back(particle);
-
-            ++particle;
+            auto particle = pic.begin();
+            for (const auto &p_unit : reference_locations)
+              {
+                if (numbers::is_finite(p_unit[0]) &&
+                    GeometryInfo<dim>::is_inside_unit_cell(
+                      p_unit, tolerance_inside_cell))
+                  particle->set_reference_location(p_unit);
+                else
+                  particles_out_of_cells[c].push_back(particle);
+
+                ++particle;
+              }
           }
-      }
+      },
+      16);
+
+    std::vector<particle_iterator> particles_out_of_cell;
+    {
+      std::size_t n_particles_out_of_cell = 0;
+      for (const auto &particles : particles_out_of_cells)
+        n_particles_out_of_cell += particles.size();
+      particles_out_of_cell.reserve(n_particles_out_of_cell);
+      for (const auto &particles : particles_out_of_cells)
+        particles_out_of_cell.insert(particles_out_of_cell.end(),
+                                     particles.begin(),
+                                     particles.end());
+    }
 
     // There are three reasons why a particle is not in its old cell:
     // It moved to another cell, to another subdomain or it left the mesh.
@@ -1291,6 +1356,10 @@ namespace Particles
     // algorithm) re-allocation will happen.
     using vector_size = typename std::vector<particle_iterator>::size_type;
 
+    // The locally owned cells that particles were moved into
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells_with_new_particles;
+
     std::set<types::subdomain_id> ghost_owners;
     if (const auto parallel_triangulation =
           dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
@@ -1317,147 +1386,184 @@ namespace Particles
         &vertex_to_cell_centers =
           triangulation_cache->get_vertex_to_cell_centers_directions();
 
-      std::vector<unsigned int> search_order;
-
-      // Reuse these vectors below, but only with a single element.
-      // Avoid resizing for every particle.
-      Point<dim>      invalid_reference_point;
-      Point<spacedim> invalid_point;
-      invalid_reference_point[0] = std::numeric_limits<double>::infinity();
-      invalid_point[0]           = std::numeric_limits<double>::infinity();
-      reference_locations.resize(1, invalid_reference_point);
-      real_locations.resize(1, invalid_point);
-
-      // Find the cells that the particles moved to.
-      for (auto &out_particle : particles_out_of_cell)
-        {
-          // make a copy of the current cell, since we will modify the
-          // variable current_cell below, but we need the original in
-          // the case the particle is not found
-          auto current_cell = out_particle->get_surrounding_cell();
-
-          real_locations[0] = out_particle->get_location();
-
-          // Record if the new cell was found
-          bool found_cell = false;
-
-          // Check if the particle is in one of the old cell's neighbors
-          // that are adjacent to the closest vertex
-          const unsigned int closest_vertex =
-            GridTools::find_closest_vertex_of_cell<dim, spacedim>(
-              current_cell, out_particle->get_location(), *mapping);
-          const unsigned int closest_vertex_index =
-            current_cell->vertex_index(closest_vertex);
-
-          const auto &candidate_cells = vertex_to_cells[closest_vertex_index];
-          const unsigned int n_candidate_cells = candidate_cells.size();
-
-          // The order of searching through the candidate cells matters for
-          // performance reasons. Start with a simple order.
-          search_order.resize(n_candidate_cells);
-          for (unsigned int i = 0; i < n_candidate_cells; ++i)
-            search_order[i] = i;
-
-          // If the particle is not on a vertex, we can do better by
-          // sorting the candidate cells by alignment with
-          // the vertex_to_particle direction.
-          Tensor<1, spacedim> vertex_to_particle =
-            out_particle->get_location() - current_cell->vertex(closest_vertex);
-
-          // Only do this if the particle is not on a vertex, otherwise we
-          // cannot normalize
-          if (vertex_to_particle.norm_square() >
-              1e4 * std::numeric_limits<double>::epsilon() *
-                std::numeric_limits<double>::epsilon() *
-                vertex_to_cell_centers[closest_vertex_index][0].norm_square())
+      // The cells the particles moved to, and their reference locations in
+      // these cells. A particle for which no cell was found retains its old
+      // cell, with found_cells set to false.
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+                                new_cells(particles_out_of_cell.size());
+      std::vector<Point<dim>>   new_reference_locations(
+        particles_out_of_cell.size());
+      std::vector<std::uint8_t> found_cells(particles_out_of_cell.size(), 0);
+
+      // Find the cells that the particles moved to. This only reads the
+      // mesh and the particles, so it can be done for many particles in
+      // parallel.
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(particles_out_of_cell.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          std::vector<unsigned int> search_order;
+
+          // Reuse these vectors below, but only with a single element.
+          // Avoid resizing for every particle.
+          Point<dim>      invalid_reference_point;
+          Point<spacedim> invalid_point;
+          invalid_reference_point[0] = std::numeric_limits<double>::infinity();
+          invalid_point[0]           = std::numeric_limits<double>::infinity();
+          std::vector<Point<dim>> reference_locations(1,
+                                                      invalid_reference_point);
+          std::vector<Point<spacedim>> real_locations(1, invalid_point);
+
+          for (unsigned int p = begin; p < end; ++p)
             {
-              vertex_to_particle /= vertex_to_particle.norm();
-              const auto &vertex_to_cells =
-                vertex_to_cell_centers[closest_vertex_index];
-
-              std::sort(search_order.begin(),
-                        search_order.end(),
-                        [&vertex_to_particle,
-                         &vertex_to_cells](const unsigned int a,
-                                           const unsigned int b) {
-                          return compare_particle_association(
-                            a, b, vertex_to_particle, vertex_to_cells);
-                        });
-            }
+              const auto &out_particle = particles_out_of_cell[p];
+
+              // make a copy of the current cell, since we will modify the
+              // variable current_cell below, but we need the original in
+              // the case the particle is not found
+              auto current_cell = out_particle->get_surrounding_cell();
+
+              real_locations[0] = out_particle->get_location();
+
+              // Record if the new cell was found
+              bool found_cell = false;
+
+              // Check if the particle is in one of the old cell's neighbors
+              // that are adjacent to the closest vertex
+              const unsigned int closest_vertex =
+                GridTools::find_closest_vertex_of_cell<dim, spacedim>(
+                  current_cell, out_particle->get_location(), *mapping);
+              const unsigned int closest_vertex_index =
+                current_cell->vertex_index(closest_vertex);
+
+              const auto &candidate_cells =
+                vertex_to_cells[closest_vertex_index];
+              const unsigned int n_candidate_cells = candidate_cells.size();
+
+              // The order of searching through the candidate cells matters
+              // for performance reasons. Start with a simple order.
+              search_order.resize(n_candidate_cells);
+              for (unsigned int i = 0; i < n_candidate_cells; ++i)
+                search_order[i] = i;
+
+              // If the particle is not on a vertex, we can do better by
+              // sorting the candidate cells by alignment with
+              // the vertex_to_particle direction.
+              Tensor<1, spacedim> vertex_to_particle =
+                out_particle->get_location() -
+                current_cell->vertex(closest_vertex);
+
+              // Only do this if the particle is not on a vertex, otherwise we
+              // cannot normalize
+              if (vertex_to_particle.norm_square() >
+                  1e4 * std::numeric_limits<double>::epsilon() *
+                    std::numeric_limits<double>::epsilon() *
+                    vertex_to_cell_centers[closest_vertex_index][0]
+                      .norm_square())
+                {
+                  vertex_to_particle /= vertex_to_particle.norm();
+                  const auto &vertex_to_cells =
+                    vertex_to_cell_centers[closest_vertex_index];
+
+                  std::sort(search_order.begin(),
+                            search_order.end(),
+                            [&vertex_to_particle,
+                             &vertex_to_cells](const unsigned int a,
+                                               const unsigned int b) {
+                              return compare_particle_association(
+                                a, b, vertex_to_particle, vertex_to_cells);
+                            });
+                }
 
-          // Search all of the candidate cells according to the determined
-          // order. Most likely we will find the particle in them.
-          for (unsigned int i = 0; i < n_candidate_cells; ++i)
-            {
-              typename std::set<
-                typename Triangulation<dim, spacedim>::active_cell_iterator>::
-                const_iterator candidate_cell = candidate_cells.begin();
+              // Search all of the candidate cells according to the determined
+              // order. Most likely we will find the particle in them.
+              for (unsigned int i = 0; i < n_candidate_cells; ++i)
+                {
+                  typename std::set<typename Triangulation<dim, spacedim>::
+                                      active_cell_iterator>::const_iterator
+                    candidate_cell = candidate_cells.begin();
 
-              std::advance(candidate_cell, search_order[i]);
-              mapping->transform_points_real_to_unit_cell(*candidate_cell,
-                                                          real_locations,
-                                                          reference_locations);
+                  std::advance(candidate_cell, search_order[i]);
+                  mapping->transform_points_real_to_unit_cell(
+                    *candidate_cell, real_locations, reference_locations);
 
-              if (GeometryInfo<dim>::is_inside_unit_cell(reference_locations[0],
-                                                         tolerance_inside_cell))
-                {
-                  current_cell = *candidate_cell;
-                  found_cell   = true;
-                  break;
+                  if (GeometryInfo<dim>::is_inside_unit_cell(
+                        reference_locations[0], tolerance_inside_cell))
+                    {
+                      current_cell = *candidate_cell;
+                      found_cell   = true;
+                      break;
+                    }
                 }
-            }
 
-          // If we did not find a cell the particle is not in a neighbor of
-          // its old cell. Look for the new cell in the whole local domain.
-          // This case should be rare.
-          if (!found_cell)
-            {
-              // For some clang-based compilers and boost versions the call to
-              // RTree::query doesn't compile. We use a slower implementation as
-              // workaround.
-              // This is fixed in boost in
-              // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
+              // If we did not find a cell the particle is not in a neighbor
+              // of its old cell. Look for the new cell in the whole local
+              // domain. This case should be rare.
+              if (!found_cell)
+                {
+                  // For some clang-based compilers and boost versions the
+                  // call to RTree::query doesn't compile. We use a slower
+                  // implementation as workaround.
+                  // This is fixed in boost in
+                  // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
 #if defined(DEAL_II_WITH_BOOST_BUNDLED) ||                \
   !(defined(__clang_major__) && __clang_major__ >= 16) || \
   BOOST_VERSION >= 108100
 
-              std::vector<std::pair<Point<spacedim>, unsigned int>>
-                closest_vertex_in_domain;
-              triangulation_cache->get_used_vertices_rtree().query(
-                boost::geometry::index::nearest(out_particle->get_location(),
-                                                1),
-                std::back_inserter(closest_vertex_in_domain));
-
-              // We should have one and only one result
-              AssertDimension(closest_vertex_in_domain.size(), 1);
-              const unsigned int closest_vertex_index_in_domain =
-                closest_vertex_in_domain[0].second;
+                  std::vector<std::pair<Point<spacedim>, unsigned int>>
+                    closest_vertex_in_domain;
+                  triangulation_cache->get_used_vertices_rtree().query(
+                    boost::geometry::index::nearest(
+                      out_particle->get_location(), 1),
+                    std::back_inserter(closest_vertex_in_domain));
+
+                  // We should have one and only one result
+                  AssertDimension(closest_vertex_in_domain.size(), 1);
+                  const unsigned int closest_vertex_index_in_domain =
+                    closest_vertex_in_domain[0].second;
 #else
-              const unsigned int closest_vertex_index_in_domain =
-                GridTools::find_closest_vertex(*mapping,
-                                               *triangulation,
-                                               out_particle->get_location());
+                  const unsigned int closest_vertex_index_in_domain =
+                    GridTools::find_closest_vertex(
+                      *mapping, *triangulation, out_particle->get_location());
 #endif
 
-              // Search all of the cells adjacent to the closest vertex of the
-              // domain. Most likely we will find the particle in them.
-              for (const auto &cell :
-                   vertex_to_cells[closest_vertex_index_in_domain])
-                {
-                  mapping->transform_points_real_to_unit_cell(
-                    cell, real_locations, reference_locations);
-
-                  if (GeometryInfo<dim>::is_inside_unit_cell(
-                        reference_locations[0], tolerance_inside_cell))
+                  // Search all of the cells adjacent to the closest vertex of
+                  // the domain. Most likely we will find the particle in
+                  // them.
+                  for (const auto &cell :
+                       vertex_to_cells[closest_vertex_index_in_domain])
                     {
-                      current_cell = cell;
-                      found_cell   = true;
-                      break;
+                      mapping->transform_points_real_to_unit_cell(
+                        cell, real_locations, reference_locations);
+
+                      if (GeometryInfo<dim>::is_inside_unit_cell(
+                            reference_locations[0], tolerance_inside_cell))
+                        {
+                          current_cell = cell;
+                          found_cell   = true;
+                          break;
+                        }
                     }
                 }
+
+              if (found_cell)
+                {
+                  new_cells[p]               = current_cell;
+                  new_reference_locations[p] = reference_locations[0];
+                  found_cells[p]             = 1;
+                }
             }
+        },
+        64);
+
+      // Now move the particles to their new cells. This changes the
+      // particle containers and needs to happen serially, in the original
+      // order of the particles.
+      for (unsigned int p = 0; p < particles_out_of_cell.size(); ++p)
+        {
+          auto &out_particle = particles_out_of_cell[p];
 
-          if (!found_cell)
+          if (found_cells[p] == 0)
             {
               // We can find no cell for this particle. It has left the
               // domain due to an integration error or an open boundary.
@@ -1469,7 +1575,8 @@ namespace Particles
 
           // If we are here, we found a cell and reference position for this
           // particle
-          out_particle->set_reference_location(reference_locations[0]);
+          const auto &current_cell = new_cells[p];
+          out_particle->set_reference_location(new_reference_locations[p]);
 
           // Reinsert the particle into our domain if we own its cell.
           // Mark it for MPI transfer otherwise
@@ -1485,6 +1592,7 @@ namespace Particles
 
               // Allocate particle with the old handle
               insert_particle(old_value, current_cell);
+              cells_with_new_particles.push_back(current_cell);
             }
           else
             {
@@ -1503,7 +1611,23 @@ namespace Particles
       {
         if (dealii::Utilities::MPI::n_mpi_processes(
               parallel_triangulation->get_communicator()) > 1)
-          send_recv_particles(moved_particles, moved_cells);
+          {
+            // send_recv_particles() invalidates the cache of the ghost
+            // particles. It is still valid, however, if no particle on this
+            // process has changed its cell
+            const bool ghost_cache_valid = ghost_particles_cache.valid;
+
+            const auto cells_with_received_particles =
+              send_recv_particles(moved_particles, moved_cells);
+            cells_with_new_particles.insert(
+              cells_with_new_particles.end(),
+              cells_with_received_particles.begin(),
+              cells_with_received_particles.end());
+
+            if (particles_out_of_cell.empty() &&
+                cells_with_received_particles.empty())
+              ghost_particles_cache.valid = ghost_cache_valid;
+          }
       }
 #endif
 
@@ -1524,6 +1648,7 @@ namespace Particles
 
     property_pool->sort_memory_slots(unsorted_handles);
 
+    return cells_with_new_particles;
   } // namespace Particles
 
 
@@ -1570,6 +1695,7 @@ namespace Particles
     // Clear ghost particles cache and invalidate it
     ghost_particles_cache.ghost_particles_by_domain.clear();
     ghost_particles_cache.valid = false;
+    free_ghost_update_requests();
 
     // In the case of a parallel simulation with periodic boundary conditions
     // the vertices associated with periodic boundaries are not directly
@@ -1669,9 +1795,179 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::update_ghost_particles(
+    const std::vector<unsigned int> &property_indices)
+  {
+    // Nothing to do in serial computations
+    const auto parallel_triangulation =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &*triangulation);
+    if (parallel_triangulation == nullptr ||
+        dealii::Utilities::MPI::n_mpi_processes(
+          parallel_triangulation->get_communicator()) == 1)
+      {
+        return;
+      }
+
 #ifdef DEAL_II_WITH_MPI
+    Assert(ghost_particles_cache.valid,
+           ExcMessage(
+             "Ghost particles cannot be updated if they first have not been "
+             "exchanged at least once with the cache enabled"));
+    for (const unsigned int index : property_indices)
+      AssertIndexRange(index, n_properties_per_particle());
+
+    auto       &cache                  = ghost_particles_cache;
+    const auto &neighbors              = cache.neighbors;
+    const auto &send_particle_pointers = cache.send_particle_pointers;
+    const auto &recv_particle_pointers = cache.recv_particle_pointers;
+
+    const unsigned int n_values_per_particle =
+      spacedim + dim + property_indices.size();
+
+    // Set up the buffers and persistent requests if this is the first
+    // call after the ghost particles have been exchanged, or if a
+    // different set of properties is requested
+    if (cache.partial_update_requests.empty() ||
+        property_indices != cache.partial_update_property_indices)
+      {
+        free_ghost_update_requests();
+        cache.partial_update_property_indices = property_indices;
+        cache.partial_update_send_data.resize(send_particle_pointers.back() *
+                                              n_values_per_particle);
+        cache.partial_update_recv_data.resize(recv_particle_pointers.back() *
+                                              n_values_per_particle);
+
+        const int mpi_tag = Utilities::MPI::internal::Tags::
+          particle_handler_update_ghost_particles;
+
+        for (unsigned int i = 0; i < neighbors.size(); ++i)
+          if (recv_particle_pointers[i + 1] > recv_particle_pointers[i])
+            {
+              cache.partial_update_requests.emplace_back();
+              const int ierr =
+                MPI_Recv_init(cache.partial_update_recv_data.data() +
+                                recv_particle_pointers[i] *
+                                  n_values_per_particle,
+                              (recv_particle_pointers[i + 1] -
+                               recv_particle_pointers[i]) *
+                                n_values_per_particle,
+                              MPI_DOUBLE,
+                              neighbors[i],
+                              mpi_tag,
+                              parallel_triangulation->get_communicator(),
+                              &cache.partial_update_requests.back());
+              AssertThrowMPI(ierr);
+            }
+
+        for (unsigned int i = 0; i < neighbors.size(); ++i)
+          if (send_particle_pointers[i + 1] > send_particle_pointers[i])
+            {
+              cache.partial_update_requests.emplace_back();
+              const int ierr =
+                MPI_Send_init(cache.partial_update_send_data.data() +
+                                send_particle_pointers[i] *
+                                  n_values_per_particle,
+                              (send_particle_pointers[i + 1] -
+                               send_particle_pointers[i]) *
+                                n_values_per_particle,
+                              MPI_DOUBLE,
+                              neighbors[i],
+                              mpi_tag,
+                              parallel_triangulation->get_communicator(),
+                              &cache.partial_update_requests.back());
+              AssertThrowMPI(ierr);
+            }
+      }
+
+    // Fill the send buffer, sorted by receiving process
+    double *send_data = cache.partial_update_send_data.data();
+    for (const auto neighbor : neighbors)
+      for (const auto &particle :
+           cache.ghost_particles_by_domain.at(neighbor))
+        {
+          const Point<spacedim> location = particle->get_location();
+          for (unsigned int d = 0; d < spacedim; ++d)
+            *send_data++ = location[d];
+
+          const Point<dim> reference_location =
+            particle->get_reference_location();
+          for (unsigned int d = 0; d < dim; ++d)
+            *send_data++ = reference_location[d];
+
+          const ArrayView<const double> properties =
+            particle->get_properties();
+          for (const unsigned int index : property_indices)
+            *send_data++ = properties[index];
+        }
+    Assert(send_data == cache.partial_update_send_data.data() +
+                          cache.partial_update_send_data.size(),
+           ExcInternalError());
+
+    if (cache.partial_update_requests.size() > 0)
+      {
+        int ierr = MPI_Startall(cache.partial_update_requests.size(),
+                                cache.partial_update_requests.data());
+        AssertThrowMPI(ierr);
+        ierr = MPI_Waitall(cache.partial_update_requests.size(),
+                           cache.partial_update_requests.data(),
+                           MPI_STATUSES_IGNORE);
+        AssertThrowMPI(ierr);
+      }
+
+    // Write the received data into the ghost particles, which are stored
+    // in the same order in which they were received
+    const double *recv_data = cache.partial_update_recv_data.data();
+    for (auto &ghost_particle : cache.ghost_particles_iterators)
+      {
+        Point<spacedim> location;
+        for (unsigned int d = 0; d < spacedim; ++d)
+          location[d] = *recv_data++;
+        ghost_particle->set_location(location);
+
+        Point<dim> reference_location;
+        for (unsigned int d = 0; d < dim; ++d)
+          reference_location[d] = *recv_data++;
+        ghost_particle->set_reference_location(reference_location);
+
+        const ArrayView<double> properties = ghost_particle->get_properties();
+        for (const unsigned int index : property_indices)
+          properties[index] = *recv_data++;
+      }
+    AssertThrow(recv_data == cache.partial_update_recv_data.data() +
+                               cache.partial_update_recv_data.size(),
+                ExcMessage("The amount of data that was received does not "
+                           "match the number of ghost particles."));
+#else
+    (void)property_indices;
+#endif
+  }
+
+
+
   template <int dim, int spacedim>
   void
+  ParticleHandler<dim, spacedim>::free_ghost_update_requests()
+  {
+#ifdef DEAL_II_WITH_MPI
+    for (auto &request : ghost_particles_cache.partial_update_requests)
+      {
+        const int ierr = MPI_Request_free(&request);
+        AssertNothrow(ierr == MPI_SUCCESS, ExcMPI(ierr));
+        (void)ierr;
+      }
+#endif
+    ghost_particles_cache.partial_update_requests.clear();
+    ghost_particles_cache.partial_update_property_indices.clear();
+  }
+
+
+
+#ifdef DEAL_II_WITH_MPI
+  template <int dim, int spacedim>
+  std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
   ParticleHandler<dim, spacedim>::send_recv_particles(
     const std::map<types::subdomain_id, std::vector<particle_iterator>>
       &particles_to_send,
@@ -1892,6 +2188,9 @@ namespace Particles
     // triangulation
     const void *recv_data_it = static_cast<const void *>(recv_data.data());
 
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells_with_received_particles;
+
     // Store the particle iterators in the cache
     auto &ghost_particles_iterators =
       ghost_particles_cache.ghost_particles_iterators;
@@ -1916,6 +2215,20 @@ namespace Particles
             recv_pointers_particles[i] +
             n_recv_data[i] * individual_particle_data_size;
 
+        auto &send_particle_pointers =
+          ghost_particles_cache.send_particle_pointers;
+        auto &recv_particle_pointers =
+          ghost_particles_cache.recv_particle_pointers;
+        send_particle_pointers.assign(n_neighbors + 1, 0);
+        recv_particle_pointers.assign(n_neighbors + 1, 0);
+        for (unsigned int i = 0; i < n_neighbors; ++i)
+          {
+            send_particle_pointers[i + 1] =
+              send_particle_pointers[i] + n_send_data[i];
+            recv_particle_pointers[i + 1] =
+              recv_particle_pointers[i] + n_recv_data[i];
+          }
+
         ghost_particles_cache.neighbors = neighbors;
 
         ghost_particles_cache.send_data.resize(
@@ -1937,6 +2250,7 @@ namespace Particles
           triangulation->create_cell_iterator(id);
 
         insert_particle(property_pool->register_particle(), cell);
+        cells_with_received_particles.push_back(cell);
         const typename particle_container::iterator &cache =
           cells_to_particle_cache[cell->active_cell_index()];
         Assert(cache->cell == cell, ExcInternalError());
@@ -1959,6 +2273,8 @@ namespace Particles
                 ExcMessage(
                   "The amount of data that was read into new particles "
                   "does not match the amount of data sent around."));
+
+    return cells_with_received_particles;
   }
 #endif
 
@@ -0,0 +1,125 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/mpi.templates.h>
+
+#include <deal.II/particles/subcycling.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  template <int dim, int spacedim>
+  Subcycling<dim, spacedim>::Subcycling(
+    const Triangulation<dim, spacedim> &triangulation,
+    ParticleHandler<dim, spacedim>     &particle_handler,
+    const unsigned int                  level_property_index,
+    const unsigned int                  max_level)
+    : triangulation(&triangulation, typeid(*this).name())
+    , particle_handler(&particle_handler, typeid(*this).name())
+    , level_property_index(level_property_index)
+    , max_level(max_level)
+    , finest_occupied_level(0)
+    , n_particles_in_cell_lists(0)
+  {
+    AssertIndexRange(level_property_index,
+                     particle_handler.n_properties_per_particle());
+    AssertThrow(max_level < 31,
+                ExcMessage("The number of substeps 2^max_level needs to be "
+                           "representable as an unsigned int."));
+
+    update_level_statistics();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Subcycling<dim, spacedim>::update_level_statistics()
+  {
+    std::vector<types::particle_index> local_particles_per_level(max_level + 1,
+                                                                 0);
+    cells_per_level.assign(max_level + 1, {});
+    for (const auto &cell : triangulation->active_cell_iterators())
+      if (cell->is_locally_owned() &&
+          particle_handler->n_particles_in_cell(cell) > 0)
+        for (const auto &particle : particle_handler->particles_in_cell(cell))
+          {
+            const unsigned int level = get_level(particle);
+            ++local_particles_per_level[level];
+            if (cells_per_level[level].empty() ||
+                cells_per_level[level].back() != cell)
+              cells_per_level[level].push_back(cell);
+          }
+    n_particles_in_cell_lists = particle_handler->n_locally_owned_particles();
+
+    particles_per_level.resize(max_level + 1);
+    Utilities::MPI::sum(local_particles_per_level,
+                        triangulation->get_communicator(),
+                        particles_per_level);
+
+    finest_occupied_level = 0;
+    for (unsigned int level = 0; level <= max_level; ++level)
+      if (particles_per_level[level] > 0)
+        finest_occupied_level = level;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Subcycling<dim, spacedim>::update_cell_lists(
+    const unsigned int coarsest_level,
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      &cells)
+  {
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+    for (unsigned int level = coarsest_level; level <= max_level; ++level)
+      cells_per_level[level].clear();
+
+    // The particles on the coarser levels have not moved, so their lists
+    // remain valid
+    for (const auto &cell : cells)
+      for (const auto &particle : particle_handler->particles_in_cell(cell))
+        {
+          const unsigned int level = get_level(particle);
+          if (level >= coarsest_level && (cells_per_level[level].empty() ||
+                                          cells_per_level[level].back() != cell))
+            cells_per_level[level].push_back(cell);
+        }
+
+    n_particles_in_cell_lists = particle_handler->n_locally_owned_particles();
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  Subcycling<dim, spacedim>::has_particles_on_or_above(
+    const unsigned int level) const
+  {
+    for (unsigned int l = level; l <= max_level; ++l)
+      if (particles_per_level[l] > 0)
+        return true;
+    return false;
+  }
+} // namespace Particles
+
+#include "subcycling.inst"
+
+DEAL_II_NAMESPACE_CLOSE
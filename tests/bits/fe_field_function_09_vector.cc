@@ -0,0 +1,185 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that the list versions of FEFieldFunction, which evaluate all points
+// of a cell at once, agree with the functions for single points and with the
+// interpolated function, also when called concurrently from several threads,
+// and when the function is interpolated onto another mesh
+
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/numerics/fe_field_function.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+class F : public Function<dim>
+{
+public:
+  F()
+    : Function<dim>(2)
+  {}
+
+  virtual void
+  vector_value(const Point<dim> &p, Vector<double> &v) const override
+  {
+    v[0] = p[0] * p[0] + p[1];
+    v[1] = p[0] * p[dim - 1];
+  }
+
+  virtual void
+  vector_gradient(const Point<dim>            &p,
+                  std::vector<Tensor<1, dim>> &gradients) const override
+  {
+    gradients[0]    = Tensor<1, dim>();
+    gradients[0][0] = 2 * p[0];
+    gradients[0][1] = 1;
+    gradients[1]    = Tensor<1, dim>();
+    gradients[1][0] += p[dim - 1];
+    gradients[1][dim - 1] += p[0];
+  }
+};
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(3);
+
+  FESystem<dim>   fe(FE_Q<dim>(2), 2);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  // the function is quadratic and can be represented exactly
+  Vector<double> solution(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler, F<dim>(), solution);
+
+  Functions::FEFieldFunction<dim> fe_function(dof_handler, solution);
+
+  std::vector<Point<dim>> points;
+  const unsigned int      n_points_1d = 7;
+  for (unsigned int i = 0; i < Utilities::pow(n_points_1d, dim); ++i)
+    {
+      Point<dim> p;
+      for (unsigned int d = 0, j = i; d < dim; ++d, j /= n_points_1d)
+        p[d] = 0.05 + 0.9 * (j % n_points_1d) / (n_points_1d - 1.) +
+               0.001 * d;
+      points.push_back(p);
+    }
+
+  std::vector<Vector<double>> values(points.size(), Vector<double>(2));
+  fe_function.vector_value_list(points, values);
+
+  std::vector<std::vector<Tensor<1, dim>>> gradients(
+    points.size(), std::vector<Tensor<1, dim>>(2));
+  fe_function.vector_gradient_list(points, gradients);
+
+  double max_difference_single = 0;
+  double max_error_value       = 0;
+  double max_error_gradient    = 0;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    {
+      Vector<double> single_value(2), exact_value(2);
+      fe_function.vector_value(points[i], single_value);
+      F<dim>().vector_value(points[i], exact_value);
+
+      std::vector<Tensor<1, dim>> exact_gradients(2);
+      F<dim>().vector_gradient(points[i], exact_gradients);
+
+      for (unsigned int c = 0; c < 2; ++c)
+        {
+          max_difference_single =
+            std::max(max_difference_single,
+                     std::abs(values[i][c] - single_value[c]));
+          max_error_value = std::max(max_error_value,
+                                     std::abs(values[i][c] - exact_value[c]));
+          max_error_gradient =
+            std::max(max_error_gradient,
+                     (gradients[i][c] - exact_gradients[c]).norm());
+        }
+    }
+
+  deallog << "dim=" << dim << std::endl;
+  deallog << "Values agree with single point evaluation: "
+          << (max_difference_single < 1e-12 ? "yes" : "no") << std::endl;
+  deallog << "Values exact: " << (max_error_value < 1e-12 ? "yes" : "no")
+          << std::endl;
+  deallog << "Gradients exact: " << (max_error_gradient < 1e-10 ? "yes" : "no")
+          << std::endl;
+
+  // evaluate chunks of the points concurrently
+  std::vector<Vector<double>> threaded_values(points.size(),
+                                              Vector<double>(2));
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(points.size()),
+    [&](const unsigned int begin, const unsigned int end) {
+      const std::vector<Point<dim>> chunk(points.begin() + begin,
+                                          points.begin() + end);
+      std::vector<Vector<double>>   chunk_values(chunk.size(),
+                                               Vector<double>(2));
+      fe_function.vector_value_list(chunk, chunk_values);
+      for (unsigned int i = begin; i < end; ++i)
+        threaded_values[i] = chunk_values[i - begin];
+    },
+    5);
+
+  double max_difference_threads = 0;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    for (unsigned int c = 0; c < 2; ++c)
+      max_difference_threads =
+        std::max(max_difference_threads,
+                 std::abs(values[i][c] - threaded_values[i][c]));
+  deallog << "Values agree with concurrent evaluation: "
+          << (max_difference_threads < 1e-12 ? "yes" : "no") << std::endl;
+
+  // interpolate onto a different mesh
+  Triangulation<dim> other_triangulation;
+  GridGenerator::hyper_cube(other_triangulation, 0.1, 0.9);
+  other_triangulation.refine_global(2);
+  DoFHandler<dim> other_dof_handler(other_triangulation);
+  other_dof_handler.distribute_dofs(fe);
+
+  Vector<double> other_solution(other_dof_handler.n_dofs());
+  VectorTools::interpolate(other_dof_handler, fe_function, other_solution);
+  Vector<double> exact_solution(other_dof_handler.n_dofs());
+  VectorTools::interpolate(other_dof_handler, F<dim>(), exact_solution);
+  other_solution -= exact_solution;
+  deallog << "Interpolation onto other mesh exact: "
+          << (other_solution.linfty_norm() < 1e-12 ? "yes" : "no")
+          << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,111 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that the list versions of FEFieldFunction agree with the functions
+// for single points also for elements without a tensor-product structure,
+// which FEPointEvaluation cannot evaluate with a shared mapping
+
+#include <deal.II/base/function_lib.h>
+
+#include <deal.II/fe/fe_dgp.h>
+#include <deal.II/fe/fe_nedelec.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/numerics/fe_field_function.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  // some arbitrary, but smooth vector
+  Vector<double> solution(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < solution.size(); ++i)
+    solution[i] = std::sin(1. + i);
+
+  Functions::FEFieldFunction<dim> fe_function(dof_handler, solution);
+
+  std::vector<Point<dim>> points;
+  const unsigned int      n_points_1d = 5;
+  for (unsigned int i = 0; i < Utilities::pow(n_points_1d, dim); ++i)
+    {
+      Point<dim> p;
+      for (unsigned int d = 0, j = i; d < dim; ++d, j /= n_points_1d)
+        p[d] = 0.05 + 0.9 * (j % n_points_1d) / (n_points_1d - 1.) +
+               0.001 * d;
+      points.push_back(p);
+    }
+
+  const unsigned int          n_components = fe.n_components();
+  std::vector<Vector<double>> values(points.size(),
+                                     Vector<double>(n_components));
+  fe_function.vector_value_list(points, values);
+
+  std::vector<std::vector<Tensor<1, dim>>> gradients(
+    points.size(), std::vector<Tensor<1, dim>>(n_components));
+  fe_function.vector_gradient_list(points, gradients);
+
+  double max_difference_value    = 0;
+  double max_difference_gradient = 0;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    {
+      Vector<double> single_value(n_components);
+      fe_function.vector_value(points[i], single_value);
+
+      std::vector<Tensor<1, dim>> single_gradients(n_components);
+      fe_function.vector_gradient(points[i], single_gradients);
+
+      for (unsigned int c = 0; c < n_components; ++c)
+        {
+          max_difference_value =
+            std::max(max_difference_value,
+                     std::abs(values[i][c] - single_value[c]));
+          max_difference_gradient =
+            std::max(max_difference_gradient,
+                     (gradients[i][c] - single_gradients[c]).norm());
+        }
+    }
+
+  deallog << fe.get_name() << ": values agree with single point evaluation: "
+          << (max_difference_value < 1e-12 ? "yes" : "no")
+          << ", gradients: " << (max_difference_gradient < 1e-10 ? "yes" : "no")
+          << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(FE_DGP<2>(1));
+  test<2>(FE_Nedelec<2>(0));
+  test<2>(FESystem<2>(FE_Q<2>(2), 1, FE_DGP<2>(1), 1));
+  test<3>(FE_Nedelec<3>(0));
+}
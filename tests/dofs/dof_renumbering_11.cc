@@ -0,0 +1,112 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check DoFRenumbering::preserve_previous_numbering: after refining a single
+// cell, the degrees of freedom on the unchanged cells keep their relative
+// order, and the returned map transfers an interpolated function exactly.
+
+
+#include <deal.II/base/function_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  FE_Q<dim>       fe(1);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  DoFRenumbering::Cuthill_McKee(dof_handler);
+
+  Vector<double> previous_solution(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler,
+                           Functions::SquareFunction<dim>(),
+                           previous_solution);
+
+  const auto previous_cell_dof_indices =
+    DoFRenumbering::extract_cell_dof_indices(dof_handler);
+  const types::global_dof_index n_previous_dofs = dof_handler.n_dofs();
+
+  // refine a single cell in the interior of the domain
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->at_boundary() == false)
+      {
+        cell->set_refine_flag();
+        break;
+      }
+  tria.execute_coarsening_and_refinement();
+
+  dof_handler.distribute_dofs(fe);
+  const std::vector<types::global_dof_index> previous_to_new =
+    DoFRenumbering::preserve_previous_numbering(dof_handler,
+                                                previous_cell_dof_indices);
+
+  Vector<double> solution(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler,
+                           Functions::SquareFunction<dim>(),
+                           solution);
+
+  unsigned int            n_preserved  = 0;
+  unsigned int            n_mismatches = 0;
+  bool                    monotone     = true;
+  types::global_dof_index last_index   = 0;
+  for (types::global_dof_index i = 0; i < previous_to_new.size(); ++i)
+    if (previous_to_new[i] != numbers::invalid_dof_index)
+      {
+        ++n_preserved;
+        if (std::abs(solution[previous_to_new[i]] - previous_solution[i]) >
+            1e-12)
+          ++n_mismatches;
+        if (n_preserved > 1 && previous_to_new[i] <= last_index)
+          monotone = false;
+        last_index = previous_to_new[i];
+      }
+
+  deallog << dim << "d: n_dofs before: " << n_previous_dofs
+          << ", after: " << dof_handler.n_dofs() << std::endl;
+  deallog << "preserved: " << n_preserved << std::endl;
+  deallog << "monotone: " << (monotone ? "yes" : "no") << std::endl;
+  deallog << "mismatches: " << n_mismatches << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check DoFRenumbering::hilbert_curve on hypercube and simplex meshes:
+// traversing the cells along the Hilbert curve through their centers must
+// encounter the degrees of freedom in consecutive order.
+
+
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_simplex_p.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+check(const Triangulation<dim> &tria, const FiniteElement<dim> &fe)
+{
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  DoFRenumbering::random(dof_handler);
+  DoFRenumbering::hilbert_curve(dof_handler);
+
+  std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+  std::vector<Point<dim>>                                     centers;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cells.push_back(cell);
+      centers.push_back(cell->center());
+    }
+  const auto hilbert_indices =
+    Utilities::inverse_Hilbert_space_filling_curve(centers);
+  std::vector<unsigned int> order(cells.size());
+  std::iota(order.begin(), order.end(), 0U);
+  std::sort(order.begin(),
+            order.end(),
+            [&](const unsigned int a, const unsigned int b) {
+              return std::tie(hilbert_indices[a], a) <
+                     std::tie(hilbert_indices[b], b);
+            });
+
+  std::vector<bool>                    touched(dof_handler.n_dofs(), false);
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  types::global_dof_index              next_index  = 0;
+  bool                                 consecutive = true;
+  for (const unsigned int c : order)
+    {
+      cells[c]->get_dof_indices(dof_indices);
+      std::sort(dof_indices.begin(), dof_indices.end());
+      for (const types::global_dof_index i : dof_indices)
+        if (touched[i] == false)
+          {
+            touched[i] = true;
+            if (i != next_index)
+              consecutive = false;
+            ++next_index;
+          }
+    }
+
+  deallog << dim << "d, " << fe.get_name() << ", " << dof_handler.n_dofs()
+          << " dofs, consecutive: " << (consecutive ? "yes" : "no")
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  {
+    Triangulation<dim> tria;
+    GridGenerator::hyper_cube(tria);
+    tria.refine_global(3);
+    check(tria, FE_Q<dim>(2));
+  }
+  {
+    Triangulation<dim> tria;
+    GridGenerator::subdivided_hyper_cube_with_simplices(tria, 4);
+    check(tria, FE_SimplexP<dim>(1));
+  }
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+
+  return 0;
+}
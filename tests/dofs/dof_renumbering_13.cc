@@ -0,0 +1,116 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check DoFRenumbering::compute_cell_based_Cuthill_McKee: the result is a
+// permutation, it does not depend on the number of threads, and the
+// bandwidth is not larger than the one of DoFRenumbering::Cuthill_McKee()
+// starting from the same numbering.
+
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+
+#include "../tests.h"
+
+
+// the bandwidth of the sparsity pattern after renumbering with new_numbers
+types::global_dof_index
+bandwidth(const DynamicSparsityPattern               &dsp,
+          const std::vector<types::global_dof_index> &new_numbers)
+{
+  types::global_dof_index result = 0;
+  for (types::global_dof_index row = 0; row < dsp.n_rows(); ++row)
+    for (auto entry = dsp.begin(row); entry != dsp.end(row); ++entry)
+      {
+        const types::global_dof_index i = new_numbers[row];
+        const types::global_dof_index j = new_numbers[entry->column()];
+        result = std::max<types::global_dof_index>(result,
+                                                   std::max(i, j) -
+                                                     std::min(i, j));
+      }
+  return result;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(3 - dim / 3);
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  DoFRenumbering::random(dof_handler);
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+
+  std::vector<types::global_dof_index> renumbering(dof_handler.n_dofs());
+  DoFRenumbering::compute_cell_based_Cuthill_McKee(renumbering, dof_handler);
+
+  MultithreadInfo::set_thread_limit(1);
+  std::vector<types::global_dof_index> renumbering_serial(
+    dof_handler.n_dofs());
+  DoFRenumbering::compute_cell_based_Cuthill_McKee(renumbering_serial,
+                                                   dof_handler);
+  MultithreadInfo::set_thread_limit(testing_max_num_threads());
+
+  std::vector<bool> found(dof_handler.n_dofs(), false);
+  for (const types::global_dof_index i : renumbering)
+    found[i] = true;
+
+  std::vector<types::global_dof_index> renumbering_standard(
+    dof_handler.n_dofs());
+  DoFRenumbering::compute_Cuthill_McKee(renumbering_standard, dof_handler);
+
+  deallog << dim << "d, permutation: "
+          << (std::find(found.begin(), found.end(), false) == found.end() ?
+                "yes" :
+                "no")
+          << ", independent of threads: "
+          << (renumbering == renumbering_serial ? "yes" : "no")
+          << ", bandwidth not larger than Cuthill_McKee(): "
+          << (bandwidth(dsp, renumbering) <=
+                  bandwidth(dsp, renumbering_standard) ?
+                "yes" :
+                "no")
+          << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check DoFRenumbering::preserve_previous_numbering on an hp::FECollection:
+// a cell whose active FE index changes to an element with the same number of
+// degrees of freedom, but a different basis, must not be considered
+// unchanged.
+
+
+#include <deal.II/base/function_lib.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_dgq.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+
+  hp::FECollection<dim> fe_collection(FE_DGQ<dim>(1),
+                                      FE_DGQArbitraryNodes<dim>(QGauss<1>(2)));
+  DoFHandler<dim>       dof_handler(tria);
+  dof_handler.distribute_dofs(fe_collection);
+
+  Vector<double> previous_solution(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler,
+                           Functions::SquareFunction<dim>(),
+                           previous_solution);
+
+  const auto previous_cell_dof_indices =
+    DoFRenumbering::extract_cell_dof_indices(dof_handler);
+
+  // switch the element on the first cell, and refine the last cell
+  dof_handler.begin_active()->set_active_fe_index(1);
+  tria.last_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  dof_handler.distribute_dofs(fe_collection);
+  const std::vector<types::global_dof_index> previous_to_new =
+    DoFRenumbering::preserve_previous_numbering(dof_handler,
+                                                previous_cell_dof_indices);
+
+  Vector<double> solution(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler,
+                           Functions::SquareFunction<dim>(),
+                           solution);
+
+  unsigned int n_preserved  = 0;
+  unsigned int n_mismatches = 0;
+  for (types::global_dof_index i = 0; i < previous_to_new.size(); ++i)
+    if (previous_to_new[i] != numbers::invalid_dof_index)
+      {
+        ++n_preserved;
+        if (std::abs(solution[previous_to_new[i]] - previous_solution[i]) >
+            1e-12)
+          ++n_mismatches;
+      }
+
+  deallog << dim << "d: n_dofs before: " << previous_to_new.size()
+          << ", after: " << dof_handler.n_dofs() << std::endl;
+  deallog << "preserved: " << n_preserved << std::endl;
+  deallog << "mismatches: " << n_mismatches << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+
+  return 0;
+}
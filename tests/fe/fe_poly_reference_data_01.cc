@@ -0,0 +1,156 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that FE_Poly shares the values and derivatives of the shape
+// functions on the reference cell between all users of the same quadrature
+// formula, and that FEValues objects using the shared data compute the same
+// shape functions as the element evaluates from its polynomial space
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+class TestFE : public FE_Q<dim>
+{
+public:
+  TestFE(const unsigned int degree)
+    : FE_Q<dim>(degree)
+  {}
+
+  using FE_Q<dim>::get_reference_data;
+  using typename FE_Q<dim>::InternalData;
+};
+
+
+
+template <int dim>
+void
+test()
+{
+  const TestFE<dim>        fe(2);
+  const QGauss<dim>        quadrature(3);
+  const QGauss<dim>        other_quadrature(4);
+  const QGaussLobatto<dim> lobatto(3);
+
+  {
+    const auto data_1 =
+      fe.get_reference_data(update_values | update_gradients, quadrature);
+    const auto data_2 = fe.get_reference_data(update_gradients, quadrature);
+    const auto data_3 =
+      fe.get_reference_data(update_gradients, other_quadrature);
+    const auto data_4 = fe.get_reference_data(update_gradients, lobatto);
+    const auto data_5 = fe.get_reference_data(update_hessians, quadrature);
+
+    deallog << "same quadrature: " << (data_1 == data_2) << std::endl;
+    deallog << "other quadrature: " << (data_1 == data_3) << ' '
+            << (data_1 == data_4) << std::endl;
+    deallog << "more update flags: " << (data_1 == data_5) << std::endl;
+    deallog << "gradients: " << data_2->shape_gradients.n_rows() << 'x'
+            << data_2->shape_gradients.n_cols() << std::endl;
+
+    // an object not attached to shared data owns empty tables
+    const typename TestFE<dim>::InternalData data_6;
+    deallog << "default constructed: " << data_6.shape_values.n_rows() << 'x'
+            << data_6.shape_values.n_cols() << std::endl;
+  }
+
+  // compare the shape functions computed by FEValues from the shared data
+  // with the ones the element evaluates from its polynomial space directly,
+  // transformed to the real cell. the hessians are only compared on an
+  // affine mesh, where no derivatives of the Jacobian enter
+  const UpdateFlags flags = update_values | update_gradients |
+                            update_hessians | update_inverse_jacobians;
+  FEValues<dim> fe_values(fe, quadrature, flags);
+
+  for (const bool affine : {false, true})
+    {
+      Triangulation<dim> tria;
+      if (affine)
+        {
+          Point<dim> corner;
+          for (unsigned int d = 0; d < dim; ++d)
+            corner[d] = 1. + d;
+          GridGenerator::hyper_rectangle(tria, Point<dim>(), corner);
+          tria.refine_global(1);
+        }
+      else
+        GridGenerator::hyper_ball(tria);
+
+      double max_difference = 0;
+      for (const auto &cell : tria.active_cell_iterators())
+        {
+          fe_values.reinit(cell);
+          for (unsigned int q = 0; q < quadrature.size(); ++q)
+            {
+              const Point<dim> &p   = quadrature.point(q);
+              const auto       &inv = fe_values.inverse_jacobian(q);
+              for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+                {
+                  max_difference =
+                    std::max(max_difference,
+                             std::abs(fe_values.shape_value(i, q) -
+                                      fe.shape_value(i, p)));
+
+                  const Tensor<1, dim> unit_grad = fe.shape_grad(i, p);
+                  Tensor<1, dim>       grad;
+                  for (unsigned int d = 0; d < dim; ++d)
+                    for (unsigned int e = 0; e < dim; ++e)
+                      grad[d] += unit_grad[e] * inv[e][d];
+                  max_difference =
+                    std::max(max_difference,
+                             (fe_values.shape_grad(i, q) - grad).norm());
+
+                  if (affine)
+                    {
+                      const Tensor<2, dim> unit_hessian =
+                        fe.shape_grad_grad(i, p);
+                      Tensor<2, dim> hessian;
+                      for (unsigned int d = 0; d < dim; ++d)
+                        for (unsigned int e = 0; e < dim; ++e)
+                          for (unsigned int k = 0; k < dim; ++k)
+                            for (unsigned int l = 0; l < dim; ++l)
+                              hessian[d][e] +=
+                                inv[k][d] * unit_hessian[k][l] * inv[l][e];
+                      max_difference =
+                        std::max(max_difference,
+                                 (fe_values.shape_hessian(i, q) - hessian)
+                                   .norm());
+                    }
+                }
+            }
+        }
+      deallog << "FEValues agree with the element on "
+              << (affine ? "affine" : "non-affine") << " mesh: "
+              << (max_difference < 1e-12) << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,112 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that FEValuesBatch computes the same shape values, gradients, JxW
+// values and quadrature points as FEValues with a MappingQ(1) for all cells
+// of a batch, including a partially filled last batch
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/fe_values_batch.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const unsigned int degree)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  // FEValuesBatch only supports straight-sided cells
+  tria.reset_all_manifolds();
+  tria.set_all_manifold_ids(numbers::flat_manifold_id);
+
+  const FE_Q<dim>     fe(degree);
+  const QGauss<dim>   quadrature(degree + 1);
+  const MappingQ<dim> mapping(1);
+
+  const UpdateFlags flags = update_values | update_gradients |
+                            update_JxW_values | update_quadrature_points;
+  FEValues<dim>      fe_values(mapping, fe, quadrature, flags);
+  FEValuesBatch<dim> fe_values_batch(mapping, fe, quadrature, flags);
+
+  constexpr unsigned int n_lanes = FEValuesBatch<dim>::n_lanes;
+
+  std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+  for (const auto &cell : tria.active_cell_iterators())
+    cells.push_back(cell);
+
+  double max_error = 0;
+  for (unsigned int batch = 0; batch < cells.size(); batch += n_lanes)
+    {
+      const unsigned int n_filled =
+        std::min<unsigned int>(n_lanes, cells.size() - batch);
+      fe_values_batch.reinit(
+        make_array_view(cells.begin() + batch,
+                        cells.begin() + batch + n_filled));
+      AssertThrow(fe_values_batch.n_active_lanes() == n_filled,
+                  ExcInternalError());
+
+      for (unsigned int lane = 0; lane < n_filled; ++lane)
+        {
+          fe_values.reinit(cells[batch + lane]);
+          for (unsigned int q = 0; q < quadrature.size(); ++q)
+            {
+              max_error = std::max(max_error,
+                                   std::abs(fe_values.JxW(q) -
+                                            fe_values_batch.JxW(q)[lane]));
+              max_error =
+                std::max(max_error,
+                         fe_values.quadrature_point(q).distance(
+                           fe_values_batch.quadrature_point(q, lane)));
+              for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+                {
+                  max_error =
+                    std::max(max_error,
+                             std::abs(fe_values.shape_value(i, q) -
+                                      fe_values_batch.shape_value(i, q)));
+                  max_error =
+                    std::max(max_error,
+                             (fe_values.shape_grad(i, q) -
+                              fe_values_batch.shape_grad(i, q, lane))
+                               .norm());
+                }
+            }
+        }
+    }
+
+  deallog << dim << "d, degree " << degree << ": "
+          << (max_error < 1e-12 ? "OK" : "FAILED") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(1);
+  test<2>(3);
+  test<3>(1);
+  test<3>(2);
+}
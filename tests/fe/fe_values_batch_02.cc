@@ -0,0 +1,98 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that FEValuesBatch rejects mappings other than MappingQ of degree
+// one, and cells that are attached to a curved manifold
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values_batch.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  const FE_Q<dim>   fe(1);
+  const QGauss<dim> quadrature(2);
+  const UpdateFlags flags = update_gradients | update_JxW_values;
+
+  for (const unsigned int degree : {1, 2})
+    try
+      {
+        FEValuesBatch<dim> fe_values(MappingQ<dim>(degree),
+                                     fe,
+                                     quadrature,
+                                     flags);
+        deallog << dim << "d, MappingQ(" << degree << "): accepted"
+                << std::endl;
+      }
+    catch (const ExceptionBase &)
+      {
+        deallog << dim << "d, MappingQ(" << degree << "): rejected"
+                << std::endl;
+      }
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  FEValuesBatch<dim> fe_values(fe, quadrature, flags);
+
+  std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+  for (const auto &cell : tria.active_cell_iterators())
+    cells.push_back(cell);
+
+  for (const bool curved : {true, false})
+    {
+      if (curved == false)
+        tria.set_all_manifold_ids(numbers::flat_manifold_id);
+
+      // go through all cells in batches, since the number of lanes depends
+      // on the vectorization available on the system
+      try
+        {
+          constexpr unsigned int n_lanes = FEValuesBatch<dim>::n_lanes;
+          for (unsigned int batch = 0; batch < cells.size(); batch += n_lanes)
+            fe_values.reinit(make_array_view(
+              cells.begin() + batch,
+              cells.begin() +
+                std::min<unsigned int>(cells.size(), batch + n_lanes)));
+          deallog << dim << "d, " << (curved ? "curved" : "flat")
+                  << " cells: accepted" << std::endl;
+        }
+      catch (const ExceptionBase &)
+        {
+          deallog << dim << "d, " << (curved ? "curved" : "flat")
+                  << " cells: rejected" << std::endl;
+        }
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
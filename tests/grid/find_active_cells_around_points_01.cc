@@ -0,0 +1,95 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test GridTools::find_active_cells_around_points() against
+// GridTools::find_active_cell_around_point() for random points inside and
+// outside of a curved domain
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const unsigned int mapping_degree)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(dim == 2 ? 4 : 2);
+
+  const MappingQ<dim>         mapping(mapping_degree);
+  const GridTools::Cache<dim> cache(tria, mapping);
+
+  std::vector<Point<dim>> points(2000);
+  for (auto &p : points)
+    p = random_point<dim>(-1.2, 1.2);
+
+  const auto cells_and_positions =
+    GridTools::find_active_cells_around_points(cache, points);
+
+  unsigned int n_found = 0, n_found_single = 0, n_wrong = 0;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    {
+      // points well outside of the unit ball are not inside the mesh. do not
+      // ask find_active_cell_around_point() about them, as it needs to check
+      // all cells for such points and would make this test slow
+      if (points[i].norm() < 1.05)
+        {
+          const auto cell_and_position =
+            GridTools::find_active_cell_around_point(cache, points[i]);
+
+          if (cell_and_position.first != tria.end())
+            ++n_found_single;
+        }
+
+      const auto &cell = cells_and_positions[i].first;
+      if (cell != tria.end())
+        {
+          ++n_found;
+          // the returned reference coordinates need to be inside the cell
+          // and be mapped back to the point
+          if (!cell->reference_cell().contains_point(
+                cells_and_positions[i].second, 1e-10) ||
+              mapping
+                  .transform_unit_to_real_cell(cell,
+                                               cells_and_positions[i].second)
+                  .distance(points[i]) > 1e-8)
+            ++n_wrong;
+        }
+    }
+
+  deallog << dim << "d, mapping degree " << mapping_degree
+          << ": same number of points found: "
+          << (n_found == n_found_single ? "yes" : "no")
+          << ", wrong positions: " << n_wrong << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(1);
+  test<2>(3);
+  test<3>(1);
+  test<3>(2);
+}
@@ -0,0 +1,118 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// test that GridTools::Cache updates its geometric data after the mesh has
+// been moved, or after update_geometry has been requested for a changed
+// MappingQEulerian, and everything after refinement or a direct emission of
+// the any_change signal
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q_eulerian.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+print_bounding_box(const std::string &name, const GridTools::Cache<dim> &cache)
+{
+  const auto &tree = cache.get_cell_bounding_boxes_rtree();
+
+  BoundingBox<dim> box = tree.begin()->first;
+  for (const auto &entry : tree)
+    box.merge_with(entry.first);
+
+  deallog << name << ": " << box.get_boundary_points().first << ", "
+          << box.get_boundary_points().second << ", " << tree.size()
+          << " boxes" << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  deallog << "dim=" << dim << std::endl;
+
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation, -1, 1);
+  triangulation.refine_global(1);
+
+  FESystem<dim>   fe(FE_Q<dim>(1), dim);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double>        displacements(dof_handler.n_dofs());
+  MappingQEulerian<dim> euler(1, dof_handler, displacements);
+
+  GridTools::Cache<dim> cache0(triangulation);
+  GridTools::Cache<dim> cache1(triangulation, euler);
+
+  print_bounding_box("Initial             ", cache0);
+  print_bounding_box("Initial (Eulerian)  ", cache1);
+
+  displacements = 0.5;
+  cache1.mark_for_update(GridTools::update_geometry);
+  print_bounding_box("Displaced (Eulerian)", cache1);
+
+  Tensor<1, dim> shift;
+  for (unsigned int d = 0; d < dim; ++d)
+    shift[d] = 1.;
+  GridTools::shift(shift, triangulation);
+  print_bounding_box("Shifted             ", cache0);
+  print_bounding_box("Shifted (Eulerian)  ", cache1);
+
+  const auto cell_and_point =
+    GridTools::find_active_cell_around_point(cache0, Point<dim>());
+  deallog << "Cell around origin: " << cell_and_point.first->center()
+          << std::endl;
+
+  // move the vertices by hand, which the triangulation does not notice, and
+  // tell the cache about it through the any_change signal
+  std::vector<bool> vertex_moved(triangulation.n_vertices(), false);
+  for (const auto &cell : triangulation.active_cell_iterators())
+    for (const unsigned int v : cell->vertex_indices())
+      if (vertex_moved[cell->vertex_index(v)] == false)
+        {
+          cell->vertex(v) += shift;
+          vertex_moved[cell->vertex_index(v)] = true;
+        }
+  triangulation.signals.any_change();
+  print_bounding_box("Moved, any_change   ", cache0);
+
+  triangulation.refine_global(1);
+  print_bounding_box("Refined             ", cache0);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,57 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check GridTools::partition_triangulation_hilbert: all partitions have
+// (almost) the same number of cells.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const unsigned int n_partitions)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(dim == 2 ? 4 : 3);
+
+  GridTools::partition_triangulation_hilbert(n_partitions, tria);
+
+  std::vector<unsigned int> n_cells(n_partitions, 0);
+  for (const auto &cell : tria.active_cell_iterators())
+    ++n_cells[cell->subdomain_id()];
+
+  deallog << dim << "d, " << n_partitions << " partitions:";
+  for (const unsigned int n : n_cells)
+    deallog << ' ' << n;
+  deallog << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(3);
+  test<2>(4);
+  test<3>(5);
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Triangulation::execute_coarsening_and_refinement() fills the cached vertex
+// indices and the global cell indices with several threads. Check that the
+// result is the same as when running with a single thread.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+template <int dim>
+void
+refine(Triangulation<dim> &tria)
+{
+  // make the mesh large enough for the parallel code paths to be used
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(dim == 2 ? 4 : 2);
+  for (unsigned int cycle = 0; cycle < 3; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->active_cell_index() % 3 == 0)
+          cell->set_refine_flag();
+        else if (cell->active_cell_index() % 7 == 0)
+          cell->set_coarsen_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria_serial;
+  MultithreadInfo::set_thread_limit(1);
+  refine(tria_serial);
+
+  Triangulation<dim> tria_parallel;
+  MultithreadInfo::set_thread_limit(testing_max_num_threads());
+  refine(tria_parallel);
+
+  AssertDimension(tria_serial.n_cells(), tria_parallel.n_cells());
+
+  unsigned int n_mismatches = 0;
+  for (auto cell_s = tria_serial.begin(), cell_p = tria_parallel.begin();
+       cell_s != tria_serial.end();
+       ++cell_s, ++cell_p)
+    {
+      for (const unsigned int v : cell_s->vertex_indices())
+        if (cell_s->vertex_index(v) != cell_p->vertex_index(v))
+          ++n_mismatches;
+      if (cell_s->global_level_cell_index() !=
+          cell_p->global_level_cell_index())
+        ++n_mismatches;
+      if (cell_s->is_active() &&
+          cell_s->global_active_cell_index() !=
+            cell_p->global_active_cell_index())
+        ++n_mismatches;
+    }
+
+  deallog << dim << "d: cells: " << tria_parallel.n_cells()
+          << ", mismatches: " << n_mismatches << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+
+  return 0;
+}
@@ -0,0 +1,100 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check MappingQ::transform_points_real_to_unit_cell for dim == spacedim-1
+// against MappingQ::transform_real_to_unit_cell, for points on a curved
+// surface and points projected onto it from outside
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim, int spacedim>
+void
+test()
+{
+  Triangulation<dim, spacedim> tria;
+  GridGenerator::hyper_sphere(tria, Point<spacedim>(), 1.0);
+  tria.refine_global(1);
+
+  const QGauss<dim> quadrature(4);
+
+  for (unsigned int degree = 1; degree < 4; ++degree)
+    {
+      MappingQ<dim, spacedim> mapping(degree);
+
+      double max_difference   = 0;
+      double max_unit_error   = 0;
+      bool   all_points_valid = true;
+      for (const auto &cell : tria.active_cell_iterators())
+        {
+          // points on the surface, and the same points moved away from it
+          std::vector<Point<spacedim>> real_points;
+          for (const auto &p : quadrature.get_points())
+            real_points.push_back(mapping.transform_unit_to_real_cell(cell, p));
+          for (const auto &p : quadrature.get_points())
+            real_points.push_back(
+              1.05 * mapping.transform_unit_to_real_cell(cell, p));
+
+          std::vector<Point<dim>> unit_points(real_points.size());
+          mapping.transform_points_real_to_unit_cell(cell,
+                                                     real_points,
+                                                     unit_points);
+
+          for (unsigned int i = 0; i < real_points.size(); ++i)
+            {
+              if (numbers::is_finite(unit_points[i][0]) == false)
+                {
+                  all_points_valid = false;
+                  continue;
+                }
+              max_difference = std::max(
+                max_difference,
+                unit_points[i].distance(
+                  mapping.transform_real_to_unit_cell(cell, real_points[i])));
+              if (i < quadrature.size())
+                max_unit_error =
+                  std::max(max_unit_error,
+                           unit_points[i].distance(quadrature.point(i)));
+            }
+        }
+
+      deallog << "dim=" << dim << " spacedim=" << spacedim
+              << " degree=" << degree
+              << " all points valid: " << (all_points_valid ? "yes" : "no")
+              << std::endl;
+      deallog << "Difference to transform_real_to_unit_cell below 1e-10: "
+              << (max_difference < 1e-10 ? "yes" : "no") << std::endl;
+      deallog << "Error of points on the surface below 1e-10: "
+              << (max_unit_error < 1e-10 ? "yes" : "no") << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1, 2>();
+  test<2, 3>();
+}
@@ -0,0 +1,101 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test that the per-thread lookup cache of ThreadLocalStorage::get() does
+// not return objects that have been removed by clear(), by moving from the
+// ThreadLocalStorage object, or by assigning to it, and that it works with
+// more objects than there are cache entries
+
+#include <deal.II/base/thread_local_storage.h>
+
+#include "../tests.h"
+
+
+void
+execute(std::vector<Threads::ThreadLocalStorage<unsigned int>> &tls,
+        const unsigned int                                      thread,
+        bool                                                   &ok)
+{
+  ok = true;
+  for (unsigned int round = 0; round < 100; ++round)
+    for (unsigned int i = 0; i < tls.size(); ++i)
+      {
+        bool          exists;
+        unsigned int &value = tls[i].get(exists);
+        if (exists != (round > 0))
+          ok = false;
+        if (round > 0 && value != 1000 * thread + i)
+          ok = false;
+        value = 1000 * thread + i;
+      }
+}
+
+
+
+void
+test()
+{
+  {
+    Threads::ThreadLocalStorage<unsigned int> tls(42u);
+    bool                                      exists;
+
+    tls.get() = 1;
+    deallog << "get: " << tls.get(exists) << ' ' << exists << std::endl;
+
+    tls.clear();
+    deallog << "after clear: " << tls.get(exists) << ' ' << exists
+            << std::endl;
+
+    tls.get() = 2;
+    Threads::ThreadLocalStorage<unsigned int> moved(std::move(tls));
+    deallog << "moved-to: " << moved.get(exists) << ' ' << exists
+            << std::endl;
+    deallog << "moved-from: " << tls.get(exists) << ' ' << exists
+            << std::endl;
+
+    Threads::ThreadLocalStorage<unsigned int> other(7u);
+    other.get() = 3;
+    other       = moved;
+    deallog << "copy-assigned: " << other.get(exists) << ' ' << exists
+            << std::endl;
+
+    moved.get() = 4;
+    deallog << "copy-assigned after change of source: " << other.get()
+            << std::endl;
+  }
+
+  {
+    std::vector<Threads::ThreadLocalStorage<unsigned int>> tls(20);
+    std::vector<std::thread>                               threads;
+    bool                                                   ok[4];
+    for (unsigned int t = 0; t < 4; ++t)
+      threads.emplace_back(execute, std::ref(tls), t, std::ref(ok[t]));
+    for (auto &thread : threads)
+      thread.join();
+    for (unsigned int t = 0; t < 4; ++t)
+      deallog << "thread " << t << ": " << (ok[t] ? "OK" : "failed")
+              << std::endl;
+  }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test();
+}
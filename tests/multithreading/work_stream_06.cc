@@ -0,0 +1,84 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test WorkStream::run_with_conflicts(): every item adds to two entries of
+// a global vector that it shares with its neighbors, with the copier doing
+// an unsynchronized read-modify-write. the result is only correct if the
+// copiers of conflicting items never run concurrently
+
+#include <deal.II/base/work_stream.h>
+
+#include "../tests.h"
+
+
+struct ScratchData
+{};
+
+
+struct CopyData
+{
+  unsigned int index;
+  double       value;
+};
+
+
+void
+test()
+{
+  const unsigned int  n_items = 2000;
+  std::vector<double> result(n_items + 1, 0.);
+
+  WorkStream::run_with_conflicts(
+    0u,
+    n_items,
+    [](const unsigned int &i) {
+      return std::vector<types::global_dof_index>{i, i + 1};
+    },
+    [](const unsigned int &i, ScratchData &, CopyData &copy) {
+      // make the cost of the worker uneven
+      double value = 0;
+      for (unsigned int k = 0; k < 100 * (i % 17); ++k)
+        value += 1e-20 * std::sin(static_cast<double>(k));
+      copy.index = i;
+      copy.value = (value < 1. ? 1. : 0.);
+    },
+    [&result](const CopyData &copy) {
+      for (unsigned int j = copy.index; j < copy.index + 2; ++j)
+        {
+          const double old_value = result[j];
+          std::this_thread::yield();
+          result[j] = old_value + copy.value;
+        }
+    },
+    ScratchData(),
+    CopyData(),
+    4);
+
+  unsigned int n_errors = 0;
+  for (unsigned int j = 0; j <= n_items; ++j)
+    if (result[j] != ((j == 0 || j == n_items) ? 1. : 2.))
+      ++n_errors;
+  deallog << "Number of wrong entries: " << n_errors << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test();
+}
@@ -0,0 +1,95 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check the weights computed by Particles::CellWeights for the different
+// cell states, and their calibration from measured times
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/cell_weights.h>
+#include <deal.II/particles/particle_handler.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tr;
+  GridGenerator::hyper_cube(tr);
+  tr.refine_global(2);
+
+  MappingQ<dim> mapping(1);
+
+  Particles::ParticleHandler<dim> particle_handler(tr, mapping);
+
+  std::vector<Point<dim>> points;
+  for (const double x : {0.1, 0.2, 0.3, 0.6, 0.65, 0.7})
+    {
+      Point<dim> point;
+      for (unsigned int d = 0; d < dim; ++d)
+        point[d] = x;
+      points.push_back(point);
+    }
+  particle_handler.insert_particles(points);
+
+  Particles::CellWeights<dim> cell_weights(tr, particle_handler);
+
+  const auto print_weights = [&]() {
+    deallog << "Cell weight: " << cell_weights.get_cell_weight()
+            << " particle weight: " << cell_weights.get_particle_weight()
+            << std::endl;
+
+    for (const auto &cell : tr.active_cell_iterators())
+      if (particle_handler.n_particles_in_cell(cell) > 0)
+        deallog << "Cell " << cell->id() << " with "
+                << particle_handler.n_particles_in_cell(cell)
+                << " particles: weight "
+                << cell_weights.weight(cell, CellStatus::cell_will_persist)
+                << ", weight of children if refined "
+                << cell_weights.weight(cell, CellStatus::cell_will_be_refined)
+                << std::endl;
+
+    deallog << "Cell " << tr.begin(1)->id() << " if coarsened: weight "
+            << cell_weights.weight(tr.begin(1),
+                                   CellStatus::children_will_be_coarsened)
+            << std::endl;
+    deallog << "Load imbalance: " << cell_weights.compute_load_imbalance()
+            << std::endl;
+  };
+
+  print_weights();
+
+  // The cells take 0.1 seconds each, and the particles 0.1 seconds each
+  cell_weights.calibrate(0.1 * tr.n_active_cells(),
+                         0.1 * particle_handler.n_locally_owned_particles());
+  print_weights();
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  initlog();
+  test<2>();
+}
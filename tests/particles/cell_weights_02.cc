@@ -0,0 +1,110 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+
+// refine a parallel::distributed::Triangulation with particles and let
+// Particles::CellWeights provide the weights for the repartitioning. The
+// weights of all future cells, including the children of refined cells that
+// p4est reports as CellStatus::cell_invalid, have to add up to the weight of
+// the refined mesh
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/filtered_iterator.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/particles/cell_weights.h>
+#include <deal.II/particles/generators.h>
+#include <deal.II/particles/particle_handler.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  // four particles per cell
+  const MappingQ1<dim>            mapping;
+  Particles::ParticleHandler<dim> particle_handler(triangulation, mapping);
+  {
+    const auto local_bounding_box =
+      GridTools::compute_mesh_predicate_bounding_box(
+        triangulation, IteratorFilters::LocallyOwnedCell());
+    const auto global_bounding_boxes =
+      Utilities::MPI::all_gather(triangulation.get_communicator(),
+                                 local_bounding_box);
+
+    Particles::Generators::quadrature_points(triangulation,
+                                             QGauss<dim>(2),
+                                             global_bounding_boxes,
+                                             particle_handler);
+  }
+
+  Particles::CellWeights<dim> cell_weights(triangulation, particle_handler);
+
+  // record the weights p4est asks for without changing them
+  unsigned int local_weight = 0;
+  triangulation.signals.weight.connect(
+    [&](const typename Triangulation<dim>::cell_iterator &cell,
+        const CellStatus status) -> unsigned int {
+      local_weight += cell_weights.weight(cell, status);
+      return 0;
+    });
+
+  for (const auto &cell : triangulation.active_cell_iterators() |
+                            IteratorFilters::LocallyOwnedCell())
+    if (cell->center()[0] < 0.5)
+      cell->set_refine_flag();
+
+  particle_handler.prepare_for_coarsening_and_refinement();
+  triangulation.execute_coarsening_and_refinement();
+  particle_handler.unpack_after_coarsening_and_refinement();
+
+  deallog << "Active cells: " << triangulation.n_global_active_cells()
+          << std::endl;
+  deallog << "Particles: " << particle_handler.n_global_particles()
+          << std::endl;
+  deallog << "Sum of weights: "
+          << Utilities::MPI::sum(local_weight, MPI_COMM_WORLD) << std::endl;
+  deallog << "Weight of the refined mesh: "
+          << triangulation.n_global_active_cells() *
+                 cell_weights.get_cell_weight() +
+               particle_handler.n_global_particles() *
+                 cell_weights.get_particle_weight()
+          << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  MPILogInitAll all;
+
+  test<2>();
+}
@@ -0,0 +1,119 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check that Particles::DataOut::write_vtu() with a particle handler writes
+// the same file as build_patches() followed by write_vtu(), both in ascii
+// and in compressed form, for scalar and vector particle properties.
+
+#include <deal.II/base/data_out_base.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/particles/data_out.h>
+#include <deal.II/particles/particle_handler.h>
+
+#include "../tests.h"
+
+template <int dim, int spacedim>
+void
+test()
+{
+  Triangulation<dim, spacedim> tr;
+
+  GridGenerator::hyper_cube(tr);
+  tr.refine_global(2);
+  MappingQ<dim, spacedim> mapping(1);
+
+  Particles::ParticleHandler<dim, spacedim> particle_handler(tr,
+                                                             mapping,
+                                                             spacedim + 1);
+
+  for (unsigned int i = 0; i < 4; ++i)
+    {
+      Point<spacedim> position;
+      for (unsigned int d = 0; d < spacedim; ++d)
+        position[d] = 0.1 + 0.2 * i + 0.05 * d;
+
+      Particles::Particle<dim, spacedim> particle(position, Point<dim>(), i);
+      const auto                         cell =
+        GridTools::find_active_cell_around_point(tr, particle.get_location());
+      auto pit = particle_handler.insert_particle(particle, cell);
+
+      pit->get_properties()[0] = 10. * i;
+      for (unsigned int d = 0; d < spacedim; ++d)
+        pit->get_properties()[d + 1] = pit->get_location()[d];
+    }
+
+  std::vector<std::string> data_names(1, "scalar");
+  std::vector<DataComponentInterpretation::DataComponentInterpretation>
+    data_interpretations(1, DataComponentInterpretation::component_is_scalar);
+  for (unsigned int d = 0; d < spacedim; ++d)
+    {
+      data_names.emplace_back("location");
+      data_interpretations.emplace_back(
+        DataComponentInterpretation::component_is_part_of_vector);
+    }
+
+  for (const auto compression_level :
+       {DataOutBase::CompressionLevel::plain_text,
+        DataOutBase::CompressionLevel::best_speed})
+    {
+      DataOutBase::VtkFlags flags;
+      flags.print_date_and_time = false;
+      flags.compression_level   = compression_level;
+
+      Particles::DataOut<dim, spacedim> patch_output;
+      patch_output.set_flags(flags);
+      patch_output.build_patches(particle_handler,
+                                 data_names,
+                                 data_interpretations);
+      std::ostringstream patch_stream;
+      patch_output.write_vtu(patch_stream);
+
+      Particles::DataOut<dim, spacedim> direct_output;
+      direct_output.set_flags(flags);
+      std::ostringstream direct_stream;
+      direct_output.write_vtu(particle_handler,
+                              direct_stream,
+                              data_names,
+                              data_interpretations);
+
+      deallog << "Output identical: "
+              << (patch_stream.str() == direct_stream.str() ? "true" :
+                                                              "false")
+              << std::endl;
+
+      if (compression_level == DataOutBase::CompressionLevel::plain_text)
+        deallog.get_file_stream() << direct_stream.str();
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog.push("2d/2d");
+  test<2, 2>();
+  deallog.pop();
+  deallog.push("3d/3d");
+  test<3, 3>();
+  deallog.pop();
+}
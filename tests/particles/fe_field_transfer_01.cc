@@ -0,0 +1,173 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test Particles::FEFieldTransfer: Interpolate scalar and vector-valued
+// fields that the finite element space represents exactly to the particles,
+// and sum particle properties into a vector.
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include <deal.II/particles/fe_field_transfer.h>
+#include <deal.II/particles/generators.h>
+#include <deal.II/particles/particle_handler.h>
+
+#include "../tests.h"
+
+
+template <int spacedim>
+class LinearFunction : public Function<spacedim>
+{
+public:
+  LinearFunction(const unsigned int n_components)
+    : Function<spacedim>(n_components)
+  {}
+
+  virtual double
+  value(const Point<spacedim> &p, const unsigned int component) const override
+  {
+    if (this->n_components == 1)
+      {
+        double value = 1.;
+        for (unsigned int d = 0; d < spacedim; ++d)
+          value += (d + 1) * p[d];
+        return value;
+      }
+    else
+      return p[component];
+  }
+};
+
+
+
+template <int dim, int spacedim>
+void
+test()
+{
+  Triangulation<dim, spacedim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  MappingQ<dim, spacedim> mapping(1);
+
+  // Properties: one scalar, one vector, and one constant
+  Particles::ParticleHandler<dim, spacedim> particle_handler(tria,
+                                                             mapping,
+                                                             spacedim + 2);
+  Particles::Generators::regular_reference_locations(
+    tria, QGauss<dim>(2).get_points(), particle_handler);
+  for (auto &particle : particle_handler)
+    particle.get_properties()[spacedim + 1] = 1.;
+
+  deallog << "Number of particles: " << particle_handler.n_global_particles()
+          << std::endl;
+
+  // Scalar field
+  FE_Q<dim, spacedim>       fe_scalar(2);
+  DoFHandler<dim, spacedim> dof_handler_scalar(tria);
+  dof_handler_scalar.distribute_dofs(fe_scalar);
+  Vector<double> scalar_field(dof_handler_scalar.n_dofs());
+  VectorTools::interpolate(mapping,
+                           dof_handler_scalar,
+                           LinearFunction<spacedim>(1),
+                           scalar_field);
+
+  Particles::FEFieldTransfer<1, dim, spacedim> scalar_transfer(
+    mapping, dof_handler_scalar, particle_handler);
+  scalar_transfer.interpolate(scalar_field, 0);
+
+  // Vector field
+  FESystem<dim, spacedim>   fe_vector(FE_Q<dim, spacedim>(1), spacedim);
+  DoFHandler<dim, spacedim> dof_handler_vector(tria);
+  dof_handler_vector.distribute_dofs(fe_vector);
+  Vector<double> vector_field(dof_handler_vector.n_dofs());
+  VectorTools::interpolate(mapping,
+                           dof_handler_vector,
+                           LinearFunction<spacedim>(spacedim),
+                           vector_field);
+
+  Particles::FEFieldTransfer<spacedim, dim, spacedim> vector_transfer(
+    mapping, dof_handler_vector, particle_handler);
+  vector_transfer.interpolate(vector_field, 1);
+
+  double scalar_error = 0, vector_error = 0;
+  for (const auto &particle : particle_handler)
+    {
+      const Point<spacedim> location = particle.get_location();
+      scalar_error =
+        std::max(scalar_error,
+                 std::abs(particle.get_properties()[0] -
+                          LinearFunction<spacedim>(1).value(location, 0)));
+      for (unsigned int d = 0; d < spacedim; ++d)
+        vector_error =
+          std::max(vector_error,
+                   std::abs(particle.get_properties()[1 + d] - location[d]));
+    }
+  deallog << "Scalar interpolation error: "
+          << filter_out_small_numbers(scalar_error, 1e-12) << std::endl;
+  deallog << "Vector interpolation error: "
+          << filter_out_small_numbers(vector_error, 1e-12) << std::endl;
+
+  // Sum up the constant property, which gives the number of particles
+  // since the shape functions form a partition of unity, and the scalar
+  // property, whose linear part sums to zero over the symmetric particle
+  // distribution
+  Vector<double> rhs(dof_handler_scalar.n_dofs());
+  scalar_transfer.test_and_sum(spacedim + 1, rhs);
+  deallog << "Sum for constant property: " << rhs.mean_value() * rhs.size()
+          << std::endl;
+
+  rhs = 0;
+  scalar_transfer.test_and_sum(0, rhs);
+  deallog << "Sum for scalar property: " << rhs.mean_value() * rhs.size()
+          << std::endl;
+
+  // Test the vector field with the first component, whose sum vanishes
+  Vector<double> vector_rhs(dof_handler_vector.n_dofs());
+  vector_transfer.test_and_sum(1, vector_rhs);
+  deallog << "Sum for vector property: "
+          << filter_out_small_numbers(vector_rhs.mean_value() *
+                                        vector_rhs.size(),
+                                      1e-12)
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d/2d");
+  test<2, 2>();
+  deallog.pop();
+  deallog.push("3d/3d");
+  test<3, 3>();
+  deallog.pop();
+}
@@ -0,0 +1,138 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check Particles::NeighborList against a brute-force search, and that the
+// list is only rebuilt once particles have moved by more than half the skin
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/neighbor_list.h>
+#include <deal.II/particles/particle_handler.h>
+
+#include "../tests.h"
+
+
+template <int dim, int spacedim>
+unsigned int
+count_wrong_lists(const Particles::NeighborList<dim, spacedim> &neighbor_list,
+                  const double                                  radius,
+                  const bool                                    exact)
+{
+  const auto  &locations    = neighbor_list.get_locations();
+  unsigned int n_wrong_list = 0;
+  for (unsigned int i = 0; i < neighbor_list.n_locally_owned_particles(); ++i)
+    {
+      std::vector<unsigned int> reference;
+      for (unsigned int j = 0; j < locations.size(); ++j)
+        if (j != i && locations[i].distance(locations[j]) <= radius)
+          reference.push_back(j);
+
+      const auto neighbors = neighbor_list.get_neighbors(i);
+      if (exact)
+        {
+          if (std::vector<unsigned int>(neighbors.begin(), neighbors.end()) !=
+              reference)
+            ++n_wrong_list;
+        }
+      else
+        {
+          for (const unsigned int j : reference)
+            if (std::find(neighbors.begin(), neighbors.end(), j) ==
+                neighbors.end())
+              {
+                ++n_wrong_list;
+                break;
+              }
+        }
+    }
+  return n_wrong_list;
+}
+
+
+
+template <int dim, int spacedim>
+void
+test()
+{
+  Triangulation<dim, spacedim> tr;
+  GridGenerator::hyper_cube(tr);
+  tr.refine_global(2);
+
+  MappingQ<dim, spacedim> mapping(1);
+
+  Particles::ParticleHandler<dim, spacedim> particle_handler(tr, mapping);
+
+  std::vector<Point<spacedim>> points(300);
+  for (auto &point : points)
+    for (unsigned int d = 0; d < spacedim; ++d)
+      point[d] = 0.8 * random_value<double>();
+  particle_handler.insert_particles(points);
+
+  const double interaction_radius = 0.1;
+  const double skin               = 0.05;
+
+  Particles::NeighborList<dim, spacedim> neighbor_list(particle_handler,
+                                                       interaction_radius,
+                                                       skin);
+  deallog << "Wrong neighbor lists: "
+          << count_wrong_lists(neighbor_list, interaction_radius + skin, true)
+          << std::endl;
+
+  const auto move_particles = [&](const double displacement) {
+    for (auto &particle : particle_handler)
+      {
+        Point<spacedim> location = particle.get_location();
+        location[0] += displacement;
+        particle.set_location(location);
+      }
+  };
+
+  move_particles(0.01);
+  deallog << "Rebuilt after small displacement: " << neighbor_list.update()
+          << std::endl;
+  deallog << "Missing neighbors: "
+          << count_wrong_lists(neighbor_list, interaction_radius, false)
+          << std::endl;
+
+  move_particles(0.05);
+  deallog << "Rebuilt after large displacement: " << neighbor_list.update()
+          << std::endl;
+  deallog << "Wrong neighbor lists: "
+          << count_wrong_lists(neighbor_list, interaction_radius + skin, true)
+          << std::endl;
+
+  deallog << "Number of rebuilds: " << neighbor_list.n_rebuilds()
+          << std::endl;
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d/2d");
+  test<2, 2>();
+  deallog.pop();
+  deallog.push("3d/3d");
+  test<3, 3>();
+  deallog.pop();
+}
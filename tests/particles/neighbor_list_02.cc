@@ -0,0 +1,136 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+
+// check Particles::NeighborList on a distributed mesh: the neighbors of the
+// particles at the boundary of the locally owned domain include ghost
+// particles, and the lists agree with a brute-force search over all particles
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/particles/neighbor_list.h>
+#include <deal.II/particles/particle_handler.h>
+
+#include <set>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const unsigned int n_points_1d,
+     const double       interaction_radius,
+     const double       skin)
+{
+  parallel::shared::Triangulation<dim> tria(
+    MPI_COMM_WORLD,
+    Triangulation<dim>::none,
+    true,
+    parallel::shared::Triangulation<dim>::partition_zorder);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+  MappingQ<dim> mapping(1);
+
+  // a lattice of particles whose points do not lie on cell faces
+  const double            spacing = 1. / n_points_1d;
+  std::vector<Point<dim>> points;
+  for (unsigned int i = 0; i < Utilities::pow(n_points_1d, dim); ++i)
+    {
+      Point<dim>   point;
+      unsigned int index = i;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          point[d] = 0.4 * spacing + spacing * (index % n_points_1d);
+          index /= n_points_1d;
+        }
+      points.push_back(point);
+    }
+
+  // every process inserts the particles in its locally owned cells
+  Particles::ParticleHandler<dim> particle_handler(tria, mapping);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      for (unsigned int i = 0; i < points.size(); ++i)
+        if (cell->point_inside(points[i]))
+          particle_handler.insert_particle(
+            Particles::Particle<dim>(points[i],
+                                     mapping.transform_real_to_unit_cell(
+                                       cell, points[i]),
+                                     i),
+            cell);
+  particle_handler.update_cached_numbers();
+  particle_handler.exchange_ghost_particles();
+
+  Particles::NeighborList<dim> neighbor_list(particle_handler,
+                                             interaction_radius,
+                                             skin);
+
+  const auto  &ids               = neighbor_list.get_ids();
+  unsigned int n_wrong_lists     = 0;
+  unsigned int n_ghost_neighbors = 0;
+  for (unsigned int i = 0; i < neighbor_list.n_locally_owned_particles(); ++i)
+    {
+      std::set<types::particle_index> reference;
+      for (unsigned int j = 0; j < points.size(); ++j)
+        if (j != ids[i] &&
+            points[ids[i]].distance(points[j]) <= interaction_radius + skin)
+          reference.insert(j);
+
+      std::set<types::particle_index> neighbors;
+      for (const unsigned int j : neighbor_list.get_neighbors(i))
+        {
+          neighbors.insert(ids[j]);
+          if (j >= neighbor_list.n_locally_owned_particles())
+            ++n_ghost_neighbors;
+        }
+
+      if (neighbors != reference)
+        ++n_wrong_lists;
+    }
+
+  deallog << "Particles: "
+          << Utilities::MPI::sum(neighbor_list.n_locally_owned_particles(),
+                                 MPI_COMM_WORLD)
+          << std::endl;
+  deallog << "Lists differing from a brute-force search: "
+          << Utilities::MPI::sum(n_wrong_lists, MPI_COMM_WORLD) << std::endl;
+  deallog << "Ghost particles among the neighbors: "
+          << (Utilities::MPI::min(n_ghost_neighbors, MPI_COMM_WORLD) > 0 ?
+                "yes" :
+                "no")
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  MPILogInitAll all;
+
+  deallog.push("2d");
+  test<2>(20, 0.06, 0.02);
+  deallog.pop();
+  deallog.push("3d");
+  test<3>(10, 0.11, 0.01);
+  deallog.pop();
+}
@@ -0,0 +1,129 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// like particle_handler_20, but update the ghost particles through the
+// variant of update_ghost_particles() that only sends the locations and a
+// subset of the properties. Call it twice with the same subset, which
+// reuses the persistent requests, and then with a different subset.
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include "../tests.h"
+
+template <int dim, int spacedim>
+void
+test()
+{
+  {
+    parallel::distributed::Triangulation<dim, spacedim> tr(MPI_COMM_WORLD);
+
+    GridGenerator::hyper_cube(tr);
+    tr.refine_global(2);
+    MappingQ<dim, spacedim> mapping(1);
+
+    Particles::ParticleHandler<dim, spacedim> particle_handler(tr, mapping, 2);
+
+    const unsigned int n_particles = 3;
+    Point<spacedim>    position;
+    Point<dim>         reference_position;
+
+    if (Utilities::MPI::this_mpi_process(tr.get_communicator()) == 0)
+      for (unsigned int p = 0; p < n_particles; ++p)
+        {
+          for (unsigned int i = 0; i < dim; ++i)
+            position[i] = 0.410 + 0.01 * p;
+
+          Particles::Particle<dim, spacedim> particle(position,
+                                                      reference_position,
+                                                      p);
+          particle_handler.insert_particle(particle, tr.begin_active());
+        }
+
+    particle_handler.sort_particles_into_subdomains_and_cells();
+
+    for (auto &particle : particle_handler)
+      {
+        particle.get_properties()[0] = 1000 + 10 * particle.get_id();
+        particle.get_properties()[1] = 2000 + 10 * particle.get_id();
+      }
+
+    particle_handler.exchange_ghost_particles(true);
+
+    const auto print_ghosts = [&]() {
+      for (auto particle = particle_handler.begin_ghost();
+           particle != particle_handler.end_ghost();
+           ++particle)
+        deallog << "Ghost particle id : " << particle->get_id()
+                << " location : " << particle->get_location()
+                << " property : " << particle->get_properties()[0] << " and "
+                << particle->get_properties()[1] << std::endl;
+    };
+
+    const auto modify_particles = [&]() {
+      for (auto &particle : particle_handler)
+        {
+          auto location = particle.get_location();
+          location[0] += 0.1;
+          particle.set_location(location);
+          particle.get_properties()[0] += 10000;
+          particle.get_properties()[1] += 10000;
+        }
+    };
+
+    print_ghosts();
+
+    for (unsigned int step = 0; step < 2; ++step)
+      {
+        deallog << "Updating location and property 1" << std::endl;
+        modify_particles();
+        particle_handler.update_ghost_particles({1});
+        print_ghosts();
+      }
+
+    deallog << "Updating location and property 0" << std::endl;
+    modify_particles();
+    particle_handler.update_ghost_particles({0});
+    print_ghosts();
+  }
+
+  deallog << "OK" << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  MPILogInitAll all;
+
+  deallog.push("2d/2d");
+  test<2, 2>();
+  deallog.pop();
+  deallog.push("2d/3d");
+  test<2, 3>();
+  deallog.pop();
+  deallog.push("3d/3d");
+  test<3, 3>();
+  deallog.pop();
+}
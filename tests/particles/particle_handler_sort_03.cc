@@ -0,0 +1,141 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that sort_particles_into_subdomains_and_cells() produces the same
+// particles in the same order, with the same property pool handles, when
+// run with a thread limit of one and with several threads, including
+// particles that leave the domain
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <tuple>
+
+#include "../tests.h"
+
+
+template <int dim>
+std::vector<std::tuple<types::particle_index,
+                       int,
+                       int,
+                       std::ptrdiff_t,
+                       Point<dim>,
+                       Point<dim>,
+                       double>>
+sort_particles(const Triangulation<dim>      &tria,
+               const std::vector<Point<dim>> &positions,
+               const std::vector<Point<dim>> &new_positions,
+               const unsigned int             n_threads,
+               unsigned int                  &n_lost)
+{
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  const MappingQ<dim>              mapping(1);
+  Particles::ParticleHandler<dim> particle_handler(tria, mapping, 1);
+
+  n_lost = 0;
+  particle_handler.signals.particle_lost.connect(
+    [&](const typename Particles::ParticleIterator<dim> &,
+        const typename Triangulation<dim>::active_cell_iterator &) {
+      ++n_lost;
+    });
+
+  particle_handler.insert_particles(positions);
+  for (auto &particle : particle_handler)
+    particle.get_properties()[0] = particle.get_id();
+
+  for (auto &particle : particle_handler)
+    particle.set_location(new_positions[particle.get_id()]);
+  particle_handler.sort_particles_into_subdomains_and_cells();
+
+  // the handle of a particle is the offset of its properties in the
+  // property pool, since there is a single property per particle
+  const double *properties_begin =
+    particle_handler.get_property_pool().get_properties(0).data();
+
+  std::vector<std::tuple<types::particle_index,
+                         int,
+                         int,
+                         std::ptrdiff_t,
+                         Point<dim>,
+                         Point<dim>,
+                         double>>
+    result;
+  for (const auto &particle : particle_handler)
+    result.emplace_back(particle.get_id(),
+                        particle.get_surrounding_cell()->level(),
+                        particle.get_surrounding_cell()->index(),
+                        particle.get_properties().data() - properties_begin,
+                        particle.get_location(),
+                        particle.get_reference_location(),
+                        particle.get_properties()[0]);
+  return result;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(dim == 2 ? 5 : 3);
+
+  // random particles that are moved by up to 0.1 in each direction, so that
+  // some of them leave the domain
+  std::vector<Point<dim>> positions(2000);
+  std::vector<Point<dim>> new_positions(positions.size());
+  for (unsigned int i = 0; i < positions.size(); ++i)
+    for (unsigned int d = 0; d < dim; ++d)
+      {
+        positions[i][d]     = random_value<double>(0.01, 0.99);
+        new_positions[i][d] = positions[i][d] + random_value<double>(-0.1, 0.1);
+      }
+
+  unsigned int n_lost_serial   = 0;
+  unsigned int n_lost_parallel = 0;
+  const auto   serial =
+    sort_particles(tria, positions, new_positions, 1, n_lost_serial);
+  const auto parallel =
+    sort_particles(tria, positions, new_positions, 4, n_lost_parallel);
+
+  MultithreadInfo::set_thread_limit(testing_max_num_threads());
+
+  deallog << dim << "d: particles: " << serial.size()
+          << ", lost: " << n_lost_serial << std::endl;
+  deallog << dim << "d: identical order, cells, handles, and properties: "
+          << (serial == parallel && n_lost_serial == n_lost_parallel ? "yes" :
+                                                                       "no")
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  test<2>();
+  test<3>();
+}
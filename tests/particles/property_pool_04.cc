@@ -0,0 +1,111 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// test the vectorized access to properties and reference locations in the
+// property pool, including a partially filled last batch
+
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/particles/property_pool.h>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  {
+    const int dim      = 2;
+    const int spacedim = 2;
+
+    using Handle = typename Particles::PropertyPool<dim, spacedim>::Handle;
+    using VectorizedArrayType = VectorizedArray<double>;
+    constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+    const unsigned int                     n_properties = 3;
+    Particles::PropertyPool<dim, spacedim> pool(n_properties);
+
+    std::vector<Handle> particle_handles;
+    for (unsigned int i = 0; i < 2 * n_lanes + 1; ++i)
+      particle_handles.push_back(pool.register_particle());
+
+    for (const auto &particle : particle_handles)
+      {
+        for (unsigned int k = 0; k < n_properties; ++k)
+          pool.get_properties(particle)[k] = 10. * particle + k;
+
+        Point<dim> reference_location;
+        for (unsigned int d = 0; d < dim; ++d)
+          reference_location[d] = 0.1 * particle + d;
+        pool.set_reference_location(particle, reference_location);
+      }
+
+    unsigned int n_mismatches = 0;
+    for (unsigned int i = 0; i < particle_handles.size(); i += n_lanes)
+      {
+        const ArrayView<const Handle> handles(
+          particle_handles.data() + i,
+          std::min<unsigned int>(n_lanes, particle_handles.size() - i));
+
+        const VectorizedArrayType values =
+          pool.gather_property<VectorizedArrayType>(handles, 1);
+        const Point<dim, VectorizedArrayType> reference_locations =
+          pool.gather_reference_locations<VectorizedArrayType>(handles);
+
+        for (unsigned int l = 0; l < handles.size(); ++l)
+          {
+            if (values[l] != pool.get_properties(handles[l])[1])
+              ++n_mismatches;
+            for (unsigned int d = 0; d < dim; ++d)
+              if (reference_locations[d][l] !=
+                  pool.get_reference_location(handles[l])[d])
+                ++n_mismatches;
+          }
+
+        pool.scatter_property(handles, 1, 2. * values);
+      }
+    deallog << "Number of mismatches: " << n_mismatches << std::endl;
+
+    for (const auto &particle : particle_handles)
+      if (particle < 3)
+        deallog << "Handle: " << particle
+                << " properties: " << pool.get_properties(particle)[0] << ' '
+                << pool.get_properties(particle)[1] << ' '
+                << pool.get_properties(particle)[2] << std::endl;
+
+    for (unsigned int i = 0; i < particle_handles.size(); ++i)
+      if (pool.get_properties(particle_handles[i])[1] !=
+            2. * (10. * particle_handles[i] + 1.) ||
+          pool.get_properties(particle_handles[i])[0] !=
+            10. * particle_handles[i])
+        deallog << "Wrong property for handle " << particle_handles[i]
+                << std::endl;
+
+    for (auto &particle : particle_handles)
+      pool.deregister_particle(particle);
+  }
+
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  test();
+}
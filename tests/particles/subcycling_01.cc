@@ -0,0 +1,132 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test Particles::Subcycling: Particles with different velocities are
+// assigned to different levels, and are advanced with the corresponding
+// number of substeps. After the time step, all particles need to be in the
+// cells that contain them.
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/subcycling.h>
+
+#include <map>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+  MappingQ<dim> mapping(1);
+
+  // Properties: velocity in x-direction and level
+  Particles::ParticleHandler<dim> particle_handler(tria, mapping, 2);
+
+  const std::vector<double> velocities = {0.1, 0.2, 0.4, 0.8};
+  const std::vector<double> heights    = {0.1, 0.3, 0.55, 0.8};
+  for (unsigned int i = 0; i < velocities.size(); ++i)
+    {
+      Point<dim> location;
+      location[0] = 0.06;
+      for (unsigned int d = 1; d < dim; ++d)
+        location[d] = heights[i];
+
+      Particles::Particle<dim> particle(location, Point<dim>(), i);
+      const auto               cell =
+        GridTools::find_active_cell_around_point(tria, location);
+      auto pit = particle_handler.insert_particle(particle, cell);
+      pit->get_properties()[0] = velocities[i];
+    }
+
+  Particles::Subcycling<dim> subcycling(tria, particle_handler, 1, 3);
+
+  const double time_step = 0.5;
+  subcycling.assign_levels(
+    time_step, [](const Particles::ParticleAccessor<dim> &particle) {
+      return particle.get_surrounding_cell()->minimum_vertex_distance() /
+             particle.get_properties()[0];
+    });
+
+  deallog << "Number of substeps: " << subcycling.n_substeps() << std::endl;
+  for (unsigned int level = 0; level < 4; ++level)
+    deallog << "Particles on level " << level << ": "
+            << subcycling.n_particles_per_level()[level] << std::endl;
+
+  std::map<types::particle_index, unsigned int> n_advances;
+  std::map<types::particle_index, double>       end_times;
+  subcycling.advance(time_step,
+                     [&](Particles::ParticleAccessor<dim> &particle,
+                         const double                      time,
+                         const double particle_time_step) {
+                       Point<dim> location = particle.get_location();
+                       location[0] +=
+                         particle.get_properties()[0] * particle_time_step;
+                       particle.set_location(location);
+
+                       ++n_advances[particle.get_id()];
+                       end_times[particle.get_id()] = time + particle_time_step;
+                     });
+
+  std::map<types::particle_index, std::string> results;
+  bool                                         all_inside = true;
+  for (const auto &particle : particle_handler)
+    {
+      std::ostringstream result;
+      result << "Particle " << particle.get_id()
+             << " level: " << subcycling.get_level(particle)
+             << " advances: " << n_advances[particle.get_id()]
+             << " end time: " << end_times[particle.get_id()]
+             << " x: " << particle.get_location()[0];
+      results[particle.get_id()] = result.str();
+
+      const Point<dim> location = mapping.transform_unit_to_real_cell(
+        particle.get_surrounding_cell(), particle.get_reference_location());
+      if (location.distance(particle.get_location()) > 1e-12)
+        all_inside = false;
+    }
+
+  for (const auto &result : results)
+    deallog << result.second << std::endl;
+  deallog << "Reference locations consistent: "
+          << (all_inside ? "true" : "false") << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
@@ -0,0 +1,152 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test Particles::Subcycling with updates of the ghost particles after every
+// substep on a shared triangulation: After the time step, the ghost
+// particles need to have the locations, reference locations, and properties
+// of the particles they are copies of.
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/subcycling.h>
+
+#include <map>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  parallel::shared::Triangulation<dim> tria(
+    MPI_COMM_WORLD,
+    Triangulation<dim>::none,
+    true,
+    parallel::shared::Triangulation<dim>::partition_zorder);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+  MappingQ<dim> mapping(1);
+
+  // Properties: velocity in y-direction, number of advances, and level
+  Particles::ParticleHandler<dim> particle_handler(tria, mapping, 3);
+
+  if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    {
+      const std::vector<double> velocities = {0.5, 6, 12, 24};
+      for (unsigned int i = 0; i < 8; ++i)
+        {
+          Point<dim> location;
+          location[0] = 0.1 + 0.1 * i;
+          location[1] = 0.21;
+          for (unsigned int d = 2; d < dim; ++d)
+            location[d] = 0.45;
+
+          Particles::Particle<dim> particle(location, Point<dim>(), i);
+          auto pit = particle_handler.insert_particle(particle,
+                                                      tria.begin_active());
+          pit->get_properties()[0] = velocities[i % velocities.size()];
+        }
+    }
+  particle_handler.sort_particles_into_subdomains_and_cells();
+  particle_handler.exchange_ghost_particles(true);
+
+  Particles::Subcycling<dim> subcycling(tria, particle_handler, 2, 3);
+
+  // move the particles up in the first time step and back down in the
+  // second one. in 2d, this moves particles to the other process and back,
+  // whereas the particles remain ghost particles of the other process in 3d
+  const double time_step = 0.025;
+  for (unsigned int step = 0; step < 2; ++step)
+    {
+      const double direction = (step == 0 ? 1. : -1.);
+
+      subcycling.assign_levels(
+        time_step, [](const Particles::ParticleAccessor<dim> &particle) {
+          return particle.get_surrounding_cell()->minimum_vertex_distance() /
+                 particle.get_properties()[0];
+        });
+
+      subcycling.advance(
+        time_step,
+        [&](Particles::ParticleAccessor<dim> &particle,
+            const double,
+            const double particle_time_step) {
+          Point<dim> location = particle.get_location();
+          location[1] +=
+            direction * particle.get_properties()[0] * particle_time_step;
+          particle.set_location(location);
+          particle.get_properties()[1] += 1;
+        },
+        std::vector<unsigned int>{1});
+
+      deallog << "Time step " << step
+              << ", substeps: " << subcycling.n_substeps() << std::endl;
+
+      std::map<types::particle_index, std::string> results;
+      for (const auto &particle : particle_handler)
+        {
+          std::ostringstream result;
+          result << "Particle " << particle.get_id()
+                 << " y: " << particle.get_location()[1]
+                 << " advances: " << particle.get_properties()[1];
+          results[particle.get_id()] = result.str();
+        }
+      for (auto particle = particle_handler.begin_ghost();
+           particle != particle_handler.end_ghost();
+           ++particle)
+        {
+          const Point<dim> location = mapping.transform_unit_to_real_cell(
+            particle->get_surrounding_cell(),
+            particle->get_reference_location());
+          std::ostringstream result;
+          result << "Ghost particle " << particle->get_id()
+                 << " y: " << particle->get_location()[1]
+                 << " advances: " << particle->get_properties()[1]
+                 << " reference location consistent: "
+                 << (location.distance(particle->get_location()) < 1e-12 ?
+                       "true" :
+                       "false");
+          results[particle->get_id()] = result.str();
+        }
+
+      for (const auto &result : results)
+        deallog << result.second << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  MPILogInitAll all;
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
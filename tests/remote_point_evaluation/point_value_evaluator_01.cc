@@ -0,0 +1,123 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test VectorTools::PointValueEvaluator for two vector-valued functions
+// evaluated at once, including a point on a vertex shared by several cells
+// and a point outside of the domain, and compare with
+// VectorTools::point_values() on a shared triangulation
+
+#include <deal.II/base/function_parser.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/numerics/vector_tools_evaluate.h>
+#include <deal.II/numerics/vector_tools_interpolate.h>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const unsigned int dim = 2;
+
+  parallel::shared::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+
+  const MappingQ<dim> mapping(1);
+  const FESystem<dim> fe(FE_Q<dim>(2), 2);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dof_handler);
+
+  // two functions that can be represented exactly by the finite element
+  VectorType vector_1(dof_handler.locally_owned_dofs(),
+                      locally_relevant_dofs,
+                      MPI_COMM_WORLD);
+  VectorType vector_2(vector_1);
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           FunctionParser<dim>("x+y; x*y"),
+                           vector_1);
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           FunctionParser<dim>("x*x; 1-y"),
+                           vector_2);
+  vector_1.update_ghost_values();
+  vector_2.update_ghost_values();
+
+  const std::vector<Point<dim>> points = {Point<dim>(0.1, 0.2),
+                                          Point<dim>(0.5, 0.5),
+                                          Point<dim>(0.33, 0.77),
+                                          Point<dim>(1.5, 0.)};
+
+  Utilities::MPI::RemotePointEvaluation<dim> cache;
+  cache.reinit(points, tria, mapping);
+
+  const VectorTools::PointValueEvaluator<dim> evaluator(cache, dof_handler);
+  deallog << "n_components: " << evaluator.n_components() << std::endl;
+
+  const Table<3, double> values =
+    evaluator.evaluate(std::vector<const VectorType *>{&vector_1, &vector_2});
+
+  const std::vector<const VectorType *> vectors = {&vector_1, &vector_2};
+  for (unsigned int v = 0; v < vectors.size(); ++v)
+    {
+      const auto reference =
+        VectorTools::point_values<2>(cache, dof_handler, *vectors[v]);
+
+      for (unsigned int p = 0; p < points.size(); ++p)
+        {
+          deallog << "vector " << v << ", point " << points[p] << ": ";
+          double difference = 0;
+          for (unsigned int c = 0; c < 2; ++c)
+            {
+              deallog << values(v, p, c) << ' ';
+              difference =
+                std::max(difference,
+                         std::abs(values(v, p, c) - reference[p][c]));
+            }
+          deallog << (difference < 1e-12 ? "OK" : "failed") << std::endl;
+        }
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test();
+}
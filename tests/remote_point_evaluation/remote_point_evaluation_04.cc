@@ -0,0 +1,139 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test Utilities::MPI::RemotePointEvaluation::update_points() for points
+// that move within their cells, into neighboring cells, farther away, and
+// out of the domain. Each process contributes the points of its locally
+// owned cells of a shared triangulation, so that moving the points also
+// moves them between processes
+
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+check(const Utilities::MPI::RemotePointEvaluation<dim> &rpe,
+      const std::vector<Point<dim>>                    &points)
+{
+  // evaluate the location of the points from the reference points stored
+  // in the cells, and compare with the given points
+  const auto locations = rpe.template evaluate_and_process<Point<dim>>(
+    [&](const ArrayView<Point<dim>> &values,
+        const typename Utilities::MPI::RemotePointEvaluation<dim>::CellData
+          &cell_data) {
+      for (const auto cell : cell_data.cell_indices())
+        {
+          const auto cell_iterator = cell_data.get_active_cell_iterator(cell);
+          const auto unit_points   = cell_data.get_unit_points(cell);
+          const auto local_values  = cell_data.get_data_view(cell, values);
+
+          for (unsigned int q = 0; q < unit_points.size(); ++q)
+            local_values[q] =
+              rpe.get_mapping().transform_unit_to_real_cell(cell_iterator,
+                                                            unit_points[q]);
+        }
+    });
+
+  double max_error = 0;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    if (rpe.point_found(i))
+      max_error = std::max(
+        max_error, locations[rpe.get_point_ptrs()[i]].distance(points[i]));
+
+  deallog << "all points found: " << rpe.all_points_found()
+          << ", locations correct: " << (max_error < 1e-10) << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  parallel::shared::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::subdivided_hyper_cube(tria, 8);
+
+  const MappingQ<dim>         mapping(1);
+  const GridTools::Cache<dim> cache(tria, mapping);
+
+  // one point in the interior of each locally owned cell
+  std::vector<Point<dim>> points;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      points.push_back(cell->center() + Point<dim>::unit_vector(0) * 0.01);
+
+  Utilities::MPI::RemotePointEvaluation<dim> rpe;
+  rpe.reinit(cache, points);
+  check(rpe, points);
+
+  const auto move_points = [&](const double distance) {
+    for (unsigned int i = 0; i < points.size(); ++i)
+      points[i][i % dim] += (i % 2 == 0 ? distance : -distance);
+  };
+
+  // move the points within their cells
+  move_points(0.02);
+  deallog << "within cells: pattern kept: " << rpe.update_points(cache, points)
+          << std::endl;
+  check(rpe, points);
+
+  // move the points by one cell width, i.e., into a neighbor. move the
+  // points at the boundary back into the domain first
+  for (auto &p : points)
+    for (unsigned int d = 0; d < dim; ++d)
+      p[d] = std::min(std::max(p[d], 0.15), 0.85);
+  deallog << "to boundary: pattern kept: " << rpe.update_points(cache, points)
+          << std::endl;
+  check(rpe, points);
+
+  move_points(0.125);
+  deallog << "to neighbors: pattern kept: " << rpe.update_points(cache, points)
+          << std::endl;
+  check(rpe, points);
+
+  // move the points by several cell widths
+  move_points(-0.4);
+  deallog << "far away: pattern kept: " << rpe.update_points(cache, points)
+          << std::endl;
+  check(rpe, points);
+
+  // the points are now partly outside of the domain, so the next update
+  // needs a new setup as well
+  move_points(0.01);
+  deallog << "outside: pattern kept: " << rpe.update_points(cache, points)
+          << std::endl;
+  check(rpe, points);
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test<2>();
+  test<3>();
+}
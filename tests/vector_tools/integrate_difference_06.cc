@@ -0,0 +1,145 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test that integrate_difference gives the same cellwise errors with one and
+// with several threads, and that a thread limit of one evaluates the exact
+// solution only on the calling thread, so that functions that are not
+// thread-safe can be used with it
+
+#include <deal.II/base/function_lib.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include <atomic>
+#include <thread>
+
+#include "../tests.h"
+
+
+
+// A function that records whether it has been evaluated on any other thread
+// than the one it was created on.
+template <int dim>
+class ThreadBoundFunction : public Functions::CosineFunction<dim>
+{
+public:
+  ThreadBoundFunction()
+    : owner(std::this_thread::get_id())
+    , used_on_other_thread(false)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int component = 0) const override
+  {
+    if (std::this_thread::get_id() != owner)
+      used_on_other_thread = true;
+    return Functions::CosineFunction<dim>::value(p, component);
+  }
+
+  virtual Tensor<1, dim>
+  gradient(const Point<dim>  &p,
+           const unsigned int component = 0) const override
+  {
+    if (std::this_thread::get_id() != owner)
+      used_on_other_thread = true;
+    return Functions::CosineFunction<dim>::gradient(p, component);
+  }
+
+  const std::thread::id     owner;
+  mutable std::atomic<bool> used_on_other_thread;
+};
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(dim == 2 ? 4 : 2);
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double> solution(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler,
+                           Functions::SquareFunction<dim>(),
+                           solution);
+
+  const std::vector<VectorTools::NormType> norms = {VectorTools::L2_norm,
+                                                    VectorTools::H1_seminorm,
+                                                    VectorTools::Linfty_norm};
+  const std::vector<std::string>           names = {"L2_norm",
+                                                    "H1_seminorm",
+                                                    "Linfty_norm"};
+  for (unsigned int n = 0; n < norms.size(); ++n)
+    {
+      std::vector<Vector<double>> cellwise_errors;
+      for (const unsigned int n_threads :
+           {1U, std::min(4U, testing_max_num_threads())})
+        {
+          MultithreadInfo::set_thread_limit(n_threads);
+
+          const ThreadBoundFunction<dim> exact_solution;
+          cellwise_errors.emplace_back(tria.n_active_cells());
+          VectorTools::integrate_difference(dof_handler,
+                                            solution,
+                                            exact_solution,
+                                            cellwise_errors.back(),
+                                            QGauss<dim>(3),
+                                            norms[n]);
+
+          if (n_threads == 1)
+            deallog << dim << "d " << names[n] << ": "
+                    << VectorTools::compute_global_error(tria,
+                                                         cellwise_errors.back(),
+                                                         norms[n])
+                    << ", only evaluated on the calling thread: "
+                    << (exact_solution.used_on_other_thread ? "no" : "yes")
+                    << std::endl;
+        }
+
+      cellwise_errors[1] -= cellwise_errors[0];
+      deallog << dim << "d " << names[n]
+              << ": difference between 1 and several threads: "
+              << cellwise_errors[1].linfty_norm() << std::endl;
+    }
+
+  MultithreadInfo::set_thread_limit(testing_max_num_threads());
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}